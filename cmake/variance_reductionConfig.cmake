@@ -0,0 +1,4 @@
+# Package config for an installed variance_reduction: find_package(variance_reduction)
+include(CMakeFindDependencyMacro)
+find_dependency(Threads)
+include("${CMAKE_CURRENT_LIST_DIR}/variance_reduction_targets.cmake")
@@ -1,15 +1,18 @@
 #include "antithetic_engine.h"
 #include <cmath>     // for the inside‐circle test: x*x + y*y ≤ 1
-#include <random>    // for std::random_device, std::uniform_real_distribution
 
 AntitheticEngine::AntitheticEngine() {
-    // Seed the RNG once at construction
-    std::random_device rd;
-    rng = std::mt19937(rd());
+    // Nondeterministic seed until seed() is called
+    rng = random_stream();
 }
 
 AntitheticEngine::~AntitheticEngine() { }
 
+// seed(): restart at (seed, stream, offset); see rng_streams.h
+void AntitheticEngine::seed(std::uint64_t seed_value, std::uint64_t stream, std::uint64_t offset) {
+    rng = RngStream(seed_value, stream, offset);
+}
+
 void AntitheticEngine::sample(int n, std::vector<Sample>& outputs) {
     // 1) Determine how many full antithetic pairs we can form:
     //    If n is even, pairs = n/2; if n is odd, pairs = (n-1)/2.
@@ -19,14 +22,13 @@ void AntitheticEngine::sample(int n, std::vector<Sample>& outputs) {
     outputs.clear();
     outputs.reserve(static_cast<size_t>(pairs));
 
-    // 3) We'll draw (u,v) ∼ Uniform([0,1]^2) for each pair
-    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    // 3) We'll draw (u,v) ∼ Uniform([0,1]^2) for each pair with uniform01 (rng_streams.h)
 
     // 4) Loop over each of the `pairs`:
     for (int i = 0; i < pairs; ++i) {
         // 4a) Draw one Uniform‐pair (u,v)
-        double u = dist(rng);
-        double v = dist(rng);
+        double u = uniform01(rng);
+        double v = uniform01(rng);
 
         // 4b) Compute f(u,v) = 4·I{u^2 + v^2 ≤ 1}
         bool inside1 = (u * u + v * v) <= 1.0;
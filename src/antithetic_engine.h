@@ -2,7 +2,7 @@
 #define ANTITHETIC_ENGINE_H
 
 #include "engine.h"     // defines `struct Sample { double x, y, value; };`
-#include <random>       // for std::mt19937
+#include "rng_streams.h"  // RngStream (counter-based, seekable PRNG)
 
 // AntitheticEngine:
 //
@@ -36,8 +36,11 @@ public:
     // At the end, outputs.size() = ⌊n/2⌋.
     void sample(int n, std::vector<Sample>& outputs) override;
 
+    // Restart the PRNG at (seed, stream, offset) of the stream registry (see Engine::seed).
+    void seed(std::uint64_t seed_value, std::uint64_t stream, std::uint64_t offset) override;
+
 private:
-    std::mt19937 rng;  // Mersenne Twister PRNG
+    RngStream rng;  // Philox stream, addressed by (seed, stream, offset)
 };
 
 #endif // ANTITHETIC_ENGINE_H
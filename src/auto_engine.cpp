@@ -0,0 +1,100 @@
+#include "auto_engine.h"      // corresponding header
+#include "engine_registry.h"  // engine_registry
+#include "rng_streams.h"      // engine_stream_id, sub_stream_id
+#include <algorithm>          // for std::min
+#include <chrono>             // for std::chrono::steady_clock
+#include <cmath>              // for std::sqrt
+#include <limits>             // for std::numeric_limits
+
+namespace {
+
+// Pilot sizing: at most 10% of the budget split across all engines, at most kMaxPilot each.
+// Below kMinPilot per engine the measurements are too noisy to be worth the samples, so the
+// pilots are skipped and kFallbackEngine runs on the whole budget.
+constexpr int kMinPilot = 256;
+constexpr int kMaxPilot = 100000;
+constexpr const char* kFallbackEngine = "Random";
+
+// Two-pass unbiased sample variance of the returned values
+double sample_variance(const std::vector<Sample>& samples) {
+    size_t N = samples.size();
+    if (N < 2) {
+        return 0.0;
+    }
+    double mean = 0.0;
+    for (const Sample& s : samples) {
+        mean += s.value;
+    }
+    mean /= static_cast<double>(N);
+    double sum_sq = 0.0;
+    for (const Sample& s : samples) {
+        double d = s.value - mean;
+        sum_sq += d * d;
+    }
+    return sum_sq / static_cast<double>(N - 1);
+}
+
+} // namespace
+
+// select_engine(): timed pilot of every registered engine, winner = min variance × cost
+AutoSelection select_engine(int total_samples, const EngineOptions& options, std::uint64_t seed) {
+    const std::vector<EngineInfo>& registry = engine_registry();
+    const int engines = static_cast<int>(registry.size());
+
+    // 1) Pilot size per engine, rounded down to an even perfect square so that
+    //    Stratified needs no adjustment and antithetic engines form whole pairs.
+    //    Rounding down keeps the total pilot spend within 10% of the budget.
+    int pilot = std::min(kMaxPilot, total_samples / (10 * engines));
+    int m = static_cast<int>(std::sqrt(static_cast<double>(pilot)));
+    m -= m % 2;
+    pilot = m * m;
+
+    AutoSelection selection;
+    selection.pilot_samples = 0;
+
+    // Budget too small for meaningful pilots: spend all of it on the fallback engine
+    if (pilot < kMinPilot) {
+        selection.winner = kFallbackEngine;
+        selection.remaining_samples = total_samples;
+        return selection;
+    }
+
+    double best = std::numeric_limits<double>::infinity();
+
+    // 2) Run and time each pilot.  The output buffer is allocated and its pages touched
+    //    up front, so the first engine's timing does not include the page faults.
+    std::vector<Sample> samples;
+    samples.resize(static_cast<size_t>(pilot));
+    samples.clear();
+    for (const EngineInfo& info : registry) {
+        std::unique_ptr<Engine> engine = info.create(options);
+        // Pilots draw from a sub-stream, so they never overlap the winner's main stream
+        engine->seed(seed, sub_stream_id(engine_stream_id(info.name), 0), 0);
+
+        auto start = std::chrono::steady_clock::now();
+        engine->sample(pilot, samples);
+        auto stop = std::chrono::steady_clock::now();
+
+        PilotResult result;
+        result.name      = info.name;
+        result.requested = pilot;
+        result.returned  = static_cast<int>(samples.size());
+        result.variance  = sample_variance(samples);
+        result.seconds   = std::chrono::duration<double>(stop - start).count();
+        result.cost      = result.returned > 0 ? result.seconds / result.returned : 0.0;
+        result.efficiency = result.variance * result.cost;
+
+        // 3) Keep the engine with the smallest variance × cost
+        if (result.returned > 1 && result.efficiency < best) {
+            best = result.efficiency;
+            selection.winner = info.name;
+        }
+
+        selection.pilot_samples += pilot;
+        selection.pilots.push_back(result);
+    }
+
+    // 4) Whatever is left of the budget (≥ 90%) goes to the winner
+    selection.remaining_samples = total_samples - selection.pilot_samples;
+    return selection;
+}
@@ -0,0 +1,47 @@
+#ifndef AUTO_ENGINE_H
+#define AUTO_ENGINE_H
+
+#include "engine_registry.h"  // EngineOptions
+#include <cstdint>  // for std::uint64_t
+#include <string>   // for std::string
+#include <vector>   // for std::vector
+
+// ENGINE = Auto: pilot-based selection of the most efficient engine.
+//
+//   For a fixed wall-clock budget T, an engine whose returned values have variance σ² and
+//   which spends c seconds per returned value reaches
+//       stderr² = σ² / (T / c) = (σ² · c) / T,
+//   so the engine with the smallest σ²·c (variance × cost per sample) is the most efficient
+//   on this machine at this sample size.  Each registered engine runs one short timed
+//   pilot; the winner then receives whatever is left of the SAMPLES budget.
+//
+//   Note: σ² is the plain sample variance of the returned values, so (as in the README
+//   table) the correlation benefit of Stratified/LatinHypercube designs is not credited.
+
+// Measurements from one engine's pilot run.
+struct PilotResult {
+    std::string name;       // registered engine name
+    int requested;          // f-calls requested for the pilot
+    int returned;           // Sample values returned by the engine
+    double variance;        // unbiased sample variance of the returned values
+    double seconds;         // wall-clock time of Engine::sample()
+    double cost;            // seconds per returned value
+    double efficiency;      // variance × cost  (smaller is better)
+};
+
+// Outcome of the selection.
+struct AutoSelection {
+    std::string winner;                 // name of the selected engine
+    int pilot_samples;                  // total f-calls spent on pilots
+    int remaining_samples;              // budget left for the winner (≥ 90% of the total)
+    std::vector<PilotResult> pilots;    // one entry per registered engine, registry order
+};
+
+// Run a pilot of every registered engine and pick the one with the smallest
+// variance × cost.  Pilots use at most 10% of `total_samples` in total; if that leaves
+// fewer than 256 f-calls per engine, no pilot runs (`pilots` stays empty) and Random gets
+// the whole budget.  Pilots are seeded from `seed` on a sub-stream of each engine's
+// registry stream (see rng_streams.h).
+AutoSelection select_engine(int total_samples, const EngineOptions& options, std::uint64_t seed);
+
+#endif // AUTO_ENGINE_H
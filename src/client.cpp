@@ -0,0 +1,248 @@
+// monte_carlo_client: test and load-testing client for `monte_carlo_pi --serve`.
+//
+//   monte_carlo_client [--socket PATH] [--engine NAME] [--samples N] [--target-stderr E]
+//                      [--seed S [--shard K] [--offset O]] [--compact] [--requests R]
+//                      [--connections C]
+//
+// With R = 1 (default) the single result is printed like monte_carlo_pi's summary.
+// With R > 1, R requests are spread over C connections; each connection keeps one request
+// in flight (closed loop) and the tool reports requests per second and latency percentiles.
+
+#include "engine_registry.h"  // engine_registry (engine name → index)
+#include "protocol.h"         // JobRequest, JobResponse
+#include "service.h"          // kDefaultSocketPath
+#include <algorithm>          // for std::sort
+#include <atomic>             // for std::atomic
+#include <cerrno>             // for errno
+#include <chrono>             // for std::chrono::steady_clock
+#include <cstdlib>            // for std::atoll, std::atof, std::strtoull
+#include <cstring>            // for std::memset, std::strerror, std::strncpy
+#include <iomanip>            // for std::fixed, std::setprecision
+#include <iostream>           // for std::cout, std::cerr
+#include <mutex>              // for std::mutex
+#include <string>             // for std::string
+#include <thread>             // for std::thread
+#include <vector>             // for std::vector
+
+#include <sys/socket.h>       // for socket, connect, send, recv
+#include <sys/un.h>           // for sockaddr_un
+#include <unistd.h>           // for close
+
+namespace {
+
+// Connect to the service; -1 on failure
+int connect_to(const std::string& path) {
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    if (connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Send one request and wait for its response (closed loop)
+bool round_trip(int fd, const JobRequest& request, JobResponse& response) {
+    const char* out = reinterpret_cast<const char*>(&request);
+    size_t left = sizeof(request);
+    while (left > 0) {
+        ssize_t sent = send(fd, out, left, MSG_NOSIGNAL);
+        if (sent <= 0) {
+            return false;
+        }
+        out += sent;
+        left -= static_cast<size_t>(sent);
+    }
+    char* in = reinterpret_cast<char*>(&response);
+    left = sizeof(response);
+    while (left > 0) {
+        ssize_t got = recv(fd, in, left, 0);
+        if (got <= 0) {
+            return false;
+        }
+        in += got;
+        left -= static_cast<size_t>(got);
+    }
+    return response.magic == kResponseMagic && response.id == request.id;
+}
+
+const char* status_name(std::uint32_t status) {
+    switch (status) {
+        case kJobOk:            return "ok";
+        case kJobUnknownEngine: return "unknown engine";
+        case kJobBadRequest:    return "bad request";
+        case kJobTargetNotMet:  return "sample cap reached before target";
+        case kJobInternalError: return "internal error";
+        default:                return "unknown status";
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    // 1) Parse options
+    std::string socket_path = kDefaultSocketPath;
+    std::string engine_name = "ConditionalControlAntithetic";
+    unsigned long long samples = 1000000;   // fixed mode default
+    bool samples_given = false;
+    double target_stderr = 0.0;
+    unsigned long long seed = 0;
+    unsigned long long shard = 0;
+    unsigned long long offset = 0;
+    bool compact = false;
+    long long requests = 1;
+    int connections = 1;
+
+    for (int a = 1; a < argc; ++a) {
+        std::string arg = argv[a];
+        bool has_value = a + 1 < argc;
+        if (arg == "--socket" && has_value)             socket_path = argv[++a];
+        else if (arg == "--engine" && has_value)        engine_name = argv[++a];
+        else if (arg == "--samples" && has_value) {
+            samples = std::strtoull(argv[++a], nullptr, 10);
+            samples_given = true;
+        }
+        else if (arg == "--target-stderr" && has_value) target_stderr = std::atof(argv[++a]);
+        else if (arg == "--seed" && has_value)          seed = std::strtoull(argv[++a], nullptr, 10);
+        else if (arg == "--shard" && has_value)         shard = std::strtoull(argv[++a], nullptr, 10);
+        else if (arg == "--offset" && has_value)        offset = std::strtoull(argv[++a], nullptr, 10);
+        else if (arg == "--compact")                    compact = true;
+        else if (arg == "--requests" && has_value)      requests = std::atoll(argv[++a]);
+        else if (arg == "--connections" && has_value)   connections = std::atoi(argv[++a]);
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--socket PATH] [--engine NAME] [--samples N]"
+                      << " [--target-stderr E] [--seed S [--shard K] [--offset O]] [--compact]"
+                      << " [--requests R] [--connections C]\n";
+            return 1;
+        }
+    }
+    // Target mode without --samples: let the service apply its own cap
+    if (target_stderr > 0.0 && !samples_given) {
+        samples = 0;
+    }
+    if (seed == 0 && (shard != 0 || offset != 0)) {
+        std::cerr << "Error: --shard and --offset need a nonzero --seed.\n";
+        return 1;
+    }
+    if (requests < 1 || connections < 1) {
+        std::cerr << "Error: --requests and --connections must be positive.\n";
+        return 1;
+    }
+
+    // 2) Engine name → registry index (client and service share the registry)
+    const std::vector<EngineInfo>& registry = engine_registry();
+    int engine_index = -1;
+    for (size_t i = 0; i < registry.size(); ++i) {
+        if (registry[i].name == engine_name) {
+            engine_index = static_cast<int>(i);
+        }
+    }
+    if (engine_index < 0) {
+        std::cerr << "Error: Unknown engine \"" << engine_name << "\".\n";
+        return 1;
+    }
+
+    JobRequest base;
+    std::memset(&base, 0, sizeof(base));
+    base.magic = kRequestMagic;
+    base.engine = static_cast<std::uint16_t>(engine_index);
+    base.compact = compact ? 1 : 0;
+    base.samples = samples;
+    base.target_stderr = target_stderr;
+    base.seed = seed;
+    base.shard = shard;
+    base.offset = offset;
+
+    // 3) Run: each connection thread claims request ids until all R are done
+    std::atomic<long long> next_id(0);
+    std::atomic<long long> failures(0);
+    std::mutex results_mutex;
+    std::vector<double> latencies_us;
+    JobResponse last_response;
+    std::memset(&last_response, 0, sizeof(last_response));
+
+    auto client = [&]() {
+        int fd = connect_to(socket_path);
+        if (fd < 0) {
+            std::cerr << "Error: Cannot connect to \"" << socket_path << "\": " << std::strerror(errno) << "\n";
+            failures += 1;
+            return;
+        }
+        std::vector<double> local;
+        JobResponse response;
+        for (long long id = next_id++; id < requests; id = next_id++) {
+            JobRequest request = base;
+            request.id = static_cast<std::uint64_t>(id);
+
+            auto start = std::chrono::steady_clock::now();
+            bool ok = round_trip(fd, request, response);
+            auto stop = std::chrono::steady_clock::now();
+            if (!ok) {
+                failures += 1;
+                break;
+            }
+            if (response.status != kJobOk) {
+                failures += 1;
+            }
+            local.push_back(std::chrono::duration<double, std::micro>(stop - start).count());
+        }
+        close(fd);
+
+        std::lock_guard<std::mutex> lock(results_mutex);
+        latencies_us.insert(latencies_us.end(), local.begin(), local.end());
+        if (!local.empty()) {
+            last_response = response;
+        }
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int c = 0; c < connections; ++c) {
+        threads.emplace_back(client);
+    }
+    for (std::thread& t : threads) {
+        t.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (latencies_us.empty()) {
+        return 1;
+    }
+
+    // 4) Single request: print the estimate
+    if (requests == 1) {
+        std::cout << std::fixed << std::setprecision(8);
+        std::cout << "Engine:            " << engine_name                  << "\n";
+        std::cout << "Status:            " << status_name(last_response.status) << "\n";
+        std::cout << "Samples Used:      " << last_response.samples_used   << "\n";
+        std::cout << "Actual Samples:    " << last_response.actual_samples << "\n";
+        std::cout << "Final Estimate π:  " << last_response.mean           << "\n";
+        std::cout << "Final Variance:    " << last_response.variance       << "\n";
+        std::cout << "Final Std. Error:  " << last_response.std_error      << "\n";
+        std::cout << "Service Time (ms): " << last_response.elapsed_ns / 1e6 << "\n";
+        std::cout << "Round Trip (ms):   " << latencies_us[0] / 1e3         << "\n";
+        return last_response.status == kJobOk ? 0 : 1;
+    }
+
+    // 5) Load test: throughput and latency percentiles
+    std::sort(latencies_us.begin(), latencies_us.end());
+    auto percentile = [&](double p) {
+        size_t i = static_cast<size_t>(p * static_cast<double>(latencies_us.size() - 1));
+        return latencies_us[i];
+    };
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "Requests:          " << latencies_us.size() << " (" << failures << " failed)\n";
+    std::cout << "Connections:       " << connections << "\n";
+    std::cout << "Requests/sec:      " << static_cast<double>(latencies_us.size()) / seconds << "\n";
+    std::cout << "Latency p50 (us):  " << percentile(0.50) << "\n";
+    std::cout << "Latency p99 (us):  " << percentile(0.99) << "\n";
+    std::cout << "Latency max (us):  " << latencies_us.back() << "\n";
+    return failures == 0 ? 0 : 1;
+}
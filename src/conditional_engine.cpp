@@ -0,0 +1,65 @@
+#include "conditional_engine.h"
+#include "control_variate.h"  // estimate_beta
+#include <cmath>              // for std::sqrt
+#include <vector>             // for std::vector
+
+ConditionalEngine::ConditionalEngine(bool antithetic_, bool control_)
+    : antithetic(antithetic_), control(control_)
+{
+    // Nondeterministic seed until seed() is called
+    rng = random_stream();
+}
+
+ConditionalEngine::~ConditionalEngine() { }
+
+// seed(): restart at (seed, stream, offset); see rng_streams.h
+void ConditionalEngine::seed(std::uint64_t seed_value, std::uint64_t stream, std::uint64_t offset) {
+    rng = RngStream(seed_value, stream, offset);
+}
+
+void ConditionalEngine::sample(int n, std::vector<Sample>& outputs) {
+    // 1) Number of returned samples: one per draw, or one per antithetic pair
+    int M = antithetic ? n / 2 : n;
+
+    outputs.clear();
+    outputs.reserve(static_cast<size_t>(M));
+
+    // 2) Only x is drawn (uniform01, rng_streams.h); y has been integrated out
+
+    // 3) Control values g_i are only kept when the control variate is requested
+    std::vector<double> fs, gs;
+    if (control) {
+        fs.resize(static_cast<size_t>(M));
+        gs.resize(static_cast<size_t>(M));
+    }
+
+    for (int i = 0; i < M; ++i) {
+        double x = uniform01(rng);
+
+        // 3a) f(x) = 4·sqrt(1 − x^2),  g(x) = x^2
+        double f = 4.0 * std::sqrt(1.0 - x * x);
+        double g = x * x;
+
+        // 3b) Antithetic partner 1−x, averaged with the original
+        if (antithetic) {
+            double x2 = 1.0 - x;
+            f = 0.5 * (f + 4.0 * std::sqrt(1.0 - x2 * x2));
+            g = 0.5 * (g + x2 * x2);
+        }
+
+        if (control) {
+            fs[i] = f;
+            gs[i] = g;
+        }
+        outputs.push_back(Sample{ x, 0.0, f });
+    }
+
+    // 4) Control variate: h_i = f_i + β·(1/3 − g_i), since E[x^2] = 1/3
+    if (control) {
+        double beta = estimate_beta(fs, gs);
+        constexpr double E_g = 1.0 / 3.0;
+        for (int i = 0; i < M; ++i) {
+            outputs[i].value = fs[i] + beta * (E_g - gs[i]);
+        }
+    }
+}
@@ -0,0 +1,47 @@
+#ifndef CONDITIONAL_ENGINE_H
+#define CONDITIONAL_ENGINE_H
+
+#include "engine.h"     // defines struct Sample { double x, y, value; };
+#include "rng_streams.h"  // RngStream (counter-based, seekable PRNG)
+
+// ConditionalEngine: conditional Monte Carlo ("Rao–Blackwellization").
+//
+//   For the quarter circle the inner integral over y is known exactly:
+//       E[ 4·I{x^2 + y^2 ≤ 1} | x ] = 4·sqrt(1 − x^2).
+//   So we only draw x ∼ Uniform(0,1) and use f(x) = 4·sqrt(1 − x^2) as the sample value.
+//   E[f] = π still, Var(f) ≈ 0.797 (vs ≈ 2.697 for hit‐or‐miss), one RNG draw per sample
+//   instead of two, and no branch in the hot loop.
+//
+//   Two optional refinements, chosen at construction:
+//     * antithetic: pair x with 1−x; each Sample.value = [f(x) + f(1−x)]/2 and
+//       n is treated as the number of f‐calls, so ⌊n/2⌋ Samples are returned
+//       (as in AntitheticEngine).
+//     * control:    control variate g = x^2 with E[g] = 1/3 (the 1‐D slice of the
+//       x^2 + y^2 control used by ControlVariateEngine).  f and g are negatively
+//       correlated; β = Cov(f,g)/Var(g) and h = f + β·(1/3 − g).  With antithetic
+//       pairs, g is also pair‐averaged: g_pair = [x^2 + (1−x)^2]/2, still E = 1/3.
+//
+//   y is integrated out analytically, so Sample.y is always 0.
+class ConditionalEngine : public Engine {
+public:
+    // Constructor: seed the RNG and choose the refinements
+    ConditionalEngine(bool antithetic_ = false, bool control_ = false);
+
+    // Destructor: nothing special
+    ~ConditionalEngine();
+
+    // sample(n, outputs):
+    //   – plain / control:          outputs.size() == n
+    //   – antithetic (± control):   outputs.size() == ⌊n/2⌋
+    void sample(int n, std::vector<Sample>& outputs) override;
+
+    // Restart the PRNG at (seed, stream, offset) of the stream registry (see Engine::seed).
+    void seed(std::uint64_t seed_value, std::uint64_t stream, std::uint64_t offset) override;
+
+private:
+    RngStream rng;  // Philox stream, addressed by (seed, stream, offset)
+    bool antithetic;   // pair x with 1−x
+    bool control;      // adjust by the g = x^2 control variate
+};
+
+#endif // CONDITIONAL_ENGINE_H
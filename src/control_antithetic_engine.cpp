@@ -1,17 +1,20 @@
 #include "control_antithetic_engine.h"
+#include "control_variate.h"    // estimate_beta
 #include <cmath>      // for std::sqrt
-#include <random>     // for std::random_device, std::uniform_real_distribution
 #include <vector>     // for std::vector
-#include <numeric>    // for std::accumulate
 
 ControlAntitheticEngine::ControlAntitheticEngine() {
-    // Seed the PRNG once at construction
-    std::random_device rd;
-    rng = std::mt19937(rd());
+    // Nondeterministic seed until seed() is called
+    rng = random_stream();
 }
 
 ControlAntitheticEngine::~ControlAntitheticEngine() { }
 
+// seed(): restart at (seed, stream, offset); see rng_streams.h
+void ControlAntitheticEngine::seed(std::uint64_t seed_value, std::uint64_t stream, std::uint64_t offset) {
+    rng = RngStream(seed_value, stream, offset);
+}
+
 void ControlAntitheticEngine::sample(int n, std::vector<Sample>& outputs) {
     // 1) Determine number of antithetic pairs M = floor(n/2).
     int M = n / 2;  // integer division automatically floors if n is odd
@@ -22,14 +25,13 @@ void ControlAntitheticEngine::sample(int n, std::vector<Sample>& outputs) {
     // 3) We'll also store the (u_i, v_i) for each pair so we can push Samples later
     std::vector<double> us(M), vs(M);
 
-    // 4) Set up Uniform(0,1) distribution for drawing u, v
-    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    // 4) u, v ∼ Uniform(0,1) come from uniform01(rng) (see rng_streams.h)
 
     // 5) Loop over each pair to compute f_pair[i], g_pair[i]
     for (int i = 0; i < M; ++i) {
         // 5a) Draw one point (u, v)
-        double u = dist(rng);
-        double v = dist(rng);
+        double u = uniform01(rng);
+        double v = uniform01(rng);
         us[i] = u;
         vs[i] = v;
 
@@ -54,35 +56,13 @@ void ControlAntitheticEngine::sample(int n, std::vector<Sample>& outputs) {
         g_pair[i] = 0.5 * (g1 + g2);
     }
 
-    // 6) Compute sample means of {f_pair} and {g_pair}
-    double sum_fpair = std::accumulate(f_pair.begin(), f_pair.end(), 0.0);
-    double sum_gpair = std::accumulate(g_pair.begin(), g_pair.end(), 0.0);
-    double mean_fpair = sum_fpair / static_cast<double>(M);
-    double mean_gpair = sum_gpair / static_cast<double>(M);
-
-    // 7) Compute sample covariance Cov(f_pair, g_pair) and sample variance Var(g_pair)
-    double sum_cov = 0.0;
-    double sum_var_g = 0.0;
-    for (int i = 0; i < M; ++i) {
-        double df = f_pair[i] - mean_fpair;   // deviation in f_pair
-        double dg = g_pair[i] - mean_gpair;   // deviation in g_pair
-        sum_cov    += df * dg;    
-        sum_var_g  += dg * dg;
-    }
-    // Unbiased estimates use denominator (M - 1)
-    double cov_f_g  = sum_cov   / static_cast<double>(M - 1);
-    double var_gpair = sum_var_g / static_cast<double>(M - 1);
-
-    // 8) Estimate β = Cov(f_pair, g_pair) / Var(g_pair) if Var(g_pair)>0, else 0
-    double beta = 0.0;
-    if (var_gpair > 0.0) {
-        beta = cov_f_g / var_gpair;
-    }
+    // 6) Estimate β = Cov(f_pair, g_pair) / Var(g_pair) if Var(g_pair)>0, else 0
+    double beta = estimate_beta(f_pair, g_pair);
 
-    // 9) Known expectation: E_uniform[g] = ∫∫(x^2+y^2) dx dy = 1/3 + 1/3 = 2/3
+    // 7) Known expectation: E_uniform[g] = ∫∫(x^2+y^2) dx dy = 1/3 + 1/3 = 2/3
     constexpr double E_g = 2.0 / 3.0;
 
-    // 10) Build outputs: for each i, h_i = f_pair[i] + β·(2/3 - g_pair[i])
+    // 8) Build outputs: for each i, h_i = f_pair[i] + β·(2/3 - g_pair[i])
     outputs.clear();
     outputs.reserve(static_cast<size_t>(M));
     for (int i = 0; i < M; ++i) {
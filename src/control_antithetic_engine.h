@@ -2,7 +2,7 @@
 #define CONTROL_ANTITHETIC_ENGINE_H
 
 #include "engine.h"     // defines struct Sample { double x, y, value; };
-#include <random>       // for std::mt19937
+#include "rng_streams.h"  // RngStream (counter-based, seekable PRNG)
 
 // ControlAntitheticEngine:
 //   * Treat `n` as the total number of f‐calls; form M = floor(n/2) antithetic pairs.
@@ -31,8 +31,11 @@ public:
     //   – outputs.size() == M
     void sample(int n, std::vector<Sample>& outputs) override;
 
+    // Restart the PRNG at (seed, stream, offset) of the stream registry (see Engine::seed).
+    void seed(std::uint64_t seed_value, std::uint64_t stream, std::uint64_t offset) override;
+
 private:
-    std::mt19937 rng;  // Mersenne Twister PRNG
+    RngStream rng;  // Philox stream, addressed by (seed, stream, offset)
 };
 
 #endif // CONTROL_ANTITHETIC_ENGINE_H
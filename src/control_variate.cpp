@@ -0,0 +1,33 @@
+#include "control_variate.h"  // corresponding header
+#include <cstddef>            // for std::size_t
+#include <numeric>            // for std::accumulate
+
+// estimate_beta(): β = Cov(f,g) / Var(g) via sample covariance and variance
+double estimate_beta(const std::vector<double>& f, const std::vector<double>& g) {
+    std::size_t N = f.size();
+    if (N < 2 || g.size() != N) {
+        return 0.0;
+    }
+
+    // 1) Sample means bar_f and bar_g
+    double bar_f = std::accumulate(f.begin(), f.end(), 0.0) / static_cast<double>(N);
+    double bar_g = std::accumulate(g.begin(), g.end(), 0.0) / static_cast<double>(N);
+
+    // 2) Cov(f,g) ≈ (1/(N-1)) ∑ (f_i - bar_f)(g_i - bar_g),  Var(g) ≈ (1/(N-1)) ∑ (g_i - bar_g)^2
+    double sum_cov = 0.0;
+    double sum_varg = 0.0;
+    for (std::size_t i = 0; i < N; ++i) {
+        double df = f[i] - bar_f;
+        double dg = g[i] - bar_g;
+        sum_cov  += df * dg;
+        sum_varg += dg * dg;
+    }
+    double cov_fg = sum_cov / static_cast<double>(N - 1);
+    double var_g  = sum_varg / static_cast<double>(N - 1);
+
+    // 3) β = Cov(f,g) / Var(g); degenerate Var(g)=0 gives β=0 (no adjustment)
+    if (var_g > 0.0) {
+        return cov_fg / var_g;
+    }
+    return 0.0;
+}
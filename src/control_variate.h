@@ -0,0 +1,16 @@
+#ifndef CONTROL_VARIATE_H
+#define CONTROL_VARIATE_H
+
+#include <vector>   // for std::vector
+
+// Shared control-variate helpers used by the ControlVariate, ControlAntithetic and
+// Conditional engines.
+//
+// Given paired observations {f_i} and {g_i}, where E[g] is known analytically,
+//   β = Cov(f,g) / Var(g)          (sample estimates, denominator N-1)
+// minimizes Var(h) for the adjusted values h_i = f_i + β·(E[g] − g_i), with E[h] = E[f].
+
+// estimate_beta(): two-pass estimate of Cov(f,g)/Var(g).  Returns 0 if Var(g)=0 or N<2.
+double estimate_beta(const std::vector<double>& f, const std::vector<double>& g);
+
+#endif // CONTROL_VARIATE_H
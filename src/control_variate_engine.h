@@ -2,7 +2,7 @@
 #define CONTROL_VARIATE_ENGINE_H
 
 #include "engine.h"      // Brings in `struct Sample { double x, y, value; };`
-#include <random>        // For std::mt19937, std::random_device
+#include "rng_streams.h"  // RngStream (counter-based, seekable PRNG)
 
 // ControlVariateEngine:
 //   - Draws N i.i.d. points (x_i, y_i) ∼ Uniform([0,1]^2).
@@ -31,8 +31,11 @@ public:
     // storing them in `outputs` as Sample{x_i, y_i, h_i}.
     void sample(int samples, std::vector<Sample>& outputs) override;
 
+    // Restart the PRNG at (seed, stream, offset) of the stream registry (see Engine::seed).
+    void seed(std::uint64_t seed_value, std::uint64_t stream, std::uint64_t offset) override;
+
 private:
-    std::mt19937 rng;  // Mersenne Twister PRNG, seeded in the constructor
+    RngStream rng;  // Philox stream, addressed by (seed, stream, offset)
 };
 
 #endif // CONTROL_VARIATE_ENGINE_H
@@ -0,0 +1,60 @@
+#include "controls.h"   // corresponding header
+#include <cmath>        // for std::sqrt, std::asinh
+#include <iostream>     // for std::cerr
+
+// control_names(): CONTROLS key spellings, catalog order
+const std::vector<std::string>& control_names() {
+    static const std::vector<std::string> names = { "x", "y", "x2+y2", "x4+y4", "r" };
+    return names;
+}
+
+// control_means(): E[g] = ∫₀¹∫₀¹ g(x,y) dx dy for each catalog entry
+const std::vector<double>& control_means() {
+    static const std::vector<double> means = {
+        1.0 / 2.0,                                     // E[x]
+        1.0 / 2.0,                                     // E[y]
+        2.0 / 3.0,                                     // E[x^2 + y^2] = 1/3 + 1/3
+        2.0 / 5.0,                                     // E[x^4 + y^4] = 1/5 + 1/5
+        (std::sqrt(2.0) + std::asinh(1.0)) / 3.0,      // E[sqrt(x^2 + y^2)]
+    };
+    return means;
+}
+
+// find_controls(): names → catalog indices, rejecting unknown or repeated names
+bool find_controls(const std::vector<std::string>& names, std::vector<int>& indices_out) {
+    const std::vector<std::string>& catalog = control_names();
+    std::vector<int> indices;
+
+    // No CONTROLS key: use every control in the catalog
+    if (names.empty()) {
+        for (int j = 0; j < kNumControls; ++j) {
+            indices.push_back(j);
+        }
+        indices_out = indices;
+        return true;
+    }
+
+    std::vector<bool> used(kNumControls, false);
+    for (const std::string& name : names) {
+        int found = -1;
+        for (int j = 0; j < kNumControls; ++j) {
+            if (catalog[j] == name) {
+                found = j;
+            }
+        }
+        if (found < 0) {
+            std::cerr << "Error: Unknown control \"" << name << "\" in CONTROLS "
+                      << "(expected x, y, x2+y2, x4+y4 or r).\n";
+            return false;
+        }
+        if (used[found]) {
+            std::cerr << "Error: Control \"" << name << "\" listed twice in CONTROLS.\n";
+            return false;
+        }
+        used[found] = true;
+        indices.push_back(found);
+    }
+
+    indices_out = indices;
+    return true;
+}
@@ -0,0 +1,45 @@
+#ifndef CONTROLS_H
+#define CONTROLS_H
+
+#include <cmath>    // for std::sqrt
+#include <string>   // for std::string
+#include <vector>   // for std::vector
+
+// Catalog of control variates g(x,y) with analytically known means under U([0,1]^2).
+//
+//   index  name     g(x,y)             E[g]
+//   0      x        x                  1/2
+//   1      y        y                  1/2
+//   2      x2+y2    x^2 + y^2          2/3
+//   3      x4+y4    x^4 + y^4          2/5
+//   4      r        sqrt(x^2 + y^2)    (sqrt(2) + asinh(1)) / 3 ≈ 0.765196
+//
+// All controls are evaluated together by evaluate_controls(), which is cheap, inlinable and
+// branch-free, so engines pick the ones they need by index instead of calling through
+// function pointers in the hot loop.
+constexpr int kNumControls = 5;
+
+// Names as written in the CONTROLS config key, in catalog order.
+const std::vector<std::string>& control_names();
+
+// Known means E[g] under U([0,1]^2), in catalog order.
+const std::vector<double>& control_means();
+
+// g_out[j] = g_j(x, y) for every catalog entry j.
+inline void evaluate_controls(double x, double y, double* g_out) {
+    double x2 = x * x;
+    double y2 = y * y;
+    double r2 = x2 + y2;
+    g_out[0] = x;
+    g_out[1] = y;
+    g_out[2] = r2;
+    g_out[3] = x2 * x2 + y2 * y2;
+    g_out[4] = std::sqrt(r2);
+}
+
+// Translate control names (e.g. from CONTROLS = x, r) into catalog indices.
+// An empty `names` list selects the whole catalog.
+// Returns false (after printing an error) on an unknown or repeated name.
+bool find_controls(const std::vector<std::string>& names, std::vector<int>& indices_out);
+
+#endif // CONTROLS_H
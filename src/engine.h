@@ -2,6 +2,7 @@
 #define ENGINE_H
 
 #include <vector>   // for std::vector
+#include <cstdint>  // for std::uint64_t
 
 // A single "sample" consists of (x, y) in [0,1]^2 and the integrand value = 4*I[x^2 + y^2 ≤ 1].
 struct Sample {
@@ -21,6 +22,24 @@ public:
     // Pure virtual: generate up to `samples` points and fill `outputs` with Sample structs.
     // Derived classes push back into `outputs` exactly one Sample per draw.
     virtual void sample(int samples, std::vector<Sample>& outputs) = 0;
+
+    // Restart the engine's PRNG at (seed, stream, offset) of the stream registry
+    // (rng_streams.h); `offset` counts 32-bit draws.  Engines seed themselves from
+    // std::random_device at construction; calling seed() makes the following sample()
+    // calls reproducible.  Callers pass stream = engine_stream_id(registered name).
+    virtual void seed(std::uint64_t seed_value, std::uint64_t stream, std::uint64_t offset) = 0;
+
+    // Compact results mode (optional).
+    // Indicator engines, whose every value is either 0.0 or 4.0, can emit one bit per draw
+    // instead of a full Sample: bit (i % 64) of words[i / 64] is set iff draw i landed inside
+    // the quarter-circle.  Unused high bits of the last word are left at zero.
+    // Returns the number of draws actually made (same adjustment rules as sample()).
+    virtual bool supports_hits() const { return false; }
+    virtual int sample_hits(int samples, std::vector<std::uint64_t>& words) {
+        (void)samples;
+        words.clear();
+        return 0;
+    }
 };
 
 #endif // ENGINE_H
@@ -0,0 +1,67 @@
+#include "engine_registry.h"            // corresponding header
+#include "random_engine.h"              // RandomEngine
+#include "stratified_engine.h"          // StratifiedEngine
+#include "exponential_engine.h"         // ExponentialEngine
+#include "antithetic_engine.h"          // AntitheticEngine
+#include "control_variate_engine.h"     // ControlVariateEngine
+#include "control_antithetic_engine.h"  // ControlAntitheticEngine
+#include "conditional_engine.h"         // ConditionalEngine
+#include "latin_hypercube_engine.h"     // LatinHypercubeEngine
+#include "multi_control_engine.h"       // MultiControlEngine
+#include "controls.h"                   // find_controls
+
+namespace {
+
+// Default for MultiControl*: the whole control catalog
+std::vector<int> all_controls_if_empty(const EngineOptions& options) {
+    std::vector<int> indices = options.controls;
+    if (indices.empty()) {
+        find_controls(std::vector<std::string>(), indices);
+    }
+    return indices;
+}
+
+} // namespace
+
+// engine_registry(): built once on first use
+const std::vector<EngineInfo>& engine_registry() {
+    static const std::vector<EngineInfo> registry = {
+        { "Random",            [](const EngineOptions&) { return std::unique_ptr<Engine>(std::make_unique<RandomEngine>()); } },
+        { "Stratified",        [](const EngineOptions&) { return std::unique_ptr<Engine>(std::make_unique<StratifiedEngine>()); } },
+        { "Exponential",       [](const EngineOptions&) {
+              double lambda = 0.6;   // hard-coded value
+              return std::unique_ptr<Engine>(std::make_unique<ExponentialEngine>(lambda));
+          } },
+        { "ControlVariate",    [](const EngineOptions&) { return std::unique_ptr<Engine>(std::make_unique<ControlVariateEngine>()); } },
+        { "Antithetic",        [](const EngineOptions&) { return std::unique_ptr<Engine>(std::make_unique<AntitheticEngine>()); } },
+        { "ControlAntithetic", [](const EngineOptions&) { return std::unique_ptr<Engine>(std::make_unique<ControlAntitheticEngine>()); } },
+        { "Conditional",       [](const EngineOptions&) { return std::unique_ptr<Engine>(std::make_unique<ConditionalEngine>()); } },
+        { "ConditionalAntithetic",
+                               [](const EngineOptions&) { return std::unique_ptr<Engine>(std::make_unique<ConditionalEngine>(true, false)); } },
+        { "ConditionalControl",
+                               [](const EngineOptions&) { return std::unique_ptr<Engine>(std::make_unique<ConditionalEngine>(false, true)); } },
+        { "ConditionalControlAntithetic",
+                               [](const EngineOptions&) { return std::unique_ptr<Engine>(std::make_unique<ConditionalEngine>(true, true)); } },
+        { "LatinHypercube",    [](const EngineOptions& o) { return std::unique_ptr<Engine>(std::make_unique<LatinHypercubeEngine>(false, o.threads)); } },
+        { "LatinHypercubeAntithetic",
+                               [](const EngineOptions& o) { return std::unique_ptr<Engine>(std::make_unique<LatinHypercubeEngine>(true, o.threads)); } },
+        { "MultiControl",      [](const EngineOptions& o) {
+              return std::unique_ptr<Engine>(std::make_unique<MultiControlEngine>(all_controls_if_empty(o), false));
+          } },
+        { "MultiControlAntithetic",
+                               [](const EngineOptions& o) {
+              return std::unique_ptr<Engine>(std::make_unique<MultiControlEngine>(all_controls_if_empty(o), true));
+          } },
+    };
+    return registry;
+}
+
+// make_engine(): linear lookup by name (the registry is small)
+std::unique_ptr<Engine> make_engine(const std::string& name, const EngineOptions& options) {
+    for (const EngineInfo& info : engine_registry()) {
+        if (info.name == name) {
+            return info.create(options);
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,31 @@
+#ifndef ENGINE_REGISTRY_H
+#define ENGINE_REGISTRY_H
+
+#include "engine.h"     // base Engine
+#include <functional>   // for std::function
+#include <memory>       // for std::unique_ptr
+#include <string>       // for std::string
+#include <vector>       // for std::vector
+
+// Engine parameters that come from the config file rather than being hard-coded.
+struct EngineOptions {
+    std::vector<int> controls;   // MultiControl*: catalog indices (controls.h); empty = all
+    int threads = 0;             // LatinHypercube*: most threads per sample() call,
+                                 // 0 = one per hardware thread (1 inside a worker pool)
+};
+
+// One selectable engine: the ENGINE name used in input.in and a factory for it.
+struct EngineInfo {
+    std::string name;                                  // e.g. "Random"
+    std::function<std::unique_ptr<Engine>(const EngineOptions&)> create;   // constructs a freshly seeded engine
+};
+
+// All registered engines, in the order they are listed in the README.
+// New engines are added here (engine_registry.cpp) and nowhere else.
+const std::vector<EngineInfo>& engine_registry();
+
+// Construct the engine registered under `name`, or return nullptr if there is none.
+std::unique_ptr<Engine> make_engine(const std::string& name,
+                                    const EngineOptions& options = EngineOptions());
+
+#endif // ENGINE_REGISTRY_H
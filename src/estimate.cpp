@@ -0,0 +1,121 @@
+#include "estimate.h"       // corresponding header
+#include "hit_stats.h"      // count_hits, hit_statistics
+#include "running_stats.h"  // RunningStats
+#include <algorithm>        // for std::max, std::min
+#include <climits>          // for INT_MAX
+#include <cmath>            // for std::ceil, std::sqrt
+#include <cstdint>          // for std::uint64_t
+#include <vector>           // for std::vector
+
+// run_estimate(): one engine call, then a single reduction pass
+Estimate run_estimate(Engine& engine, int samples, bool compact,
+                      const ReductionCallback& on_step) {
+    Estimate result{ 0, 0.0, 0.0, 0.0 };
+
+    // Compact mode: one bit per draw, closed-form statistics from the hit count
+    if (compact && engine.supports_hits()) {
+        std::vector<std::uint64_t> words;
+        result.actual_samples = engine.sample_hits(samples, words);
+        const long long total = result.actual_samples;
+
+        if (on_step) {
+            // Running statistics once per 64-draw word instead of once per draw
+            on_step(ReductionStep{ 0, total, nullptr, 0, 0.0, 0.0, 0.0 });
+            long long hits = 0;
+            for (size_t w = 0; w < words.size(); ++w) {
+                hits += popcount64(words[w]);
+                long long n = std::min<long long>(static_cast<long long>(w + 1) * 64, total);
+                HitStats running = hit_statistics(n, hits);
+                on_step(ReductionStep{ n, total, nullptr, hits,
+                                       running.mean, running.variance, running.std_error });
+            }
+        }
+
+        HitStats stats = hit_statistics(result.actual_samples, count_hits(words));
+        result.mean      = stats.mean;
+        result.variance  = stats.variance;
+        result.std_error = stats.std_error;
+        return result;
+    }
+
+    // Full mode: Welford over the returned values
+    std::vector<Sample> outputs;
+    engine.sample(samples, outputs);
+    const long long total = static_cast<long long>(outputs.size());
+    RunningStats stats;
+    if (on_step) {
+        on_step(ReductionStep{ 0, total, nullptr, 0, 0.0, 0.0, 0.0 });
+        for (const Sample& s : outputs) {
+            stats.push(s.value);
+            on_step(ReductionStep{ stats.count(), total, &s, 0,
+                                   stats.mean(), stats.variance(), stats.std_error() });
+        }
+    } else {
+        for (const Sample& s : outputs) {
+            stats.push(s.value);
+        }
+    }
+    result.actual_samples = static_cast<int>(outputs.size());
+    result.mean      = stats.mean();
+    result.variance  = stats.variance();
+    result.std_error = stats.std_error();
+    return result;
+}
+
+// run_to_target(): batches sized from the running variance until stderr ≤ target
+TargetEstimate run_to_target(Engine& engine, double target_stderr, long long max_samples,
+                             bool compact) {
+    // Smallest batch: enough values for a usable variance estimate.  Largest batch: bounds
+    // the Sample buffer (~100 MB) however far the target is; bigger needs just loop.
+    constexpr long long kMinBatch = 1 << 14;
+    constexpr long long kMaxBatch = 1 << 22;
+
+    RunningStats stats;
+    long long used = 0;
+    long long next_batch = kMinBatch;
+
+    while (used < max_samples) {
+        long long batch = std::min<long long>({ next_batch, kMaxBatch, max_samples - used });
+
+        // Round down to an even perfect square, so Stratified needs no adjustment (and no
+        // warning) and antithetic engines form whole pairs
+        long long m = static_cast<long long>(std::sqrt(static_cast<double>(batch)));
+        m -= m % 2;
+        batch = m * m;
+        if (batch == 0) {
+            break;   // less than 4 f-calls left under the cap
+        }
+
+        Estimate part = run_estimate(engine, static_cast<int>(batch), compact);
+        used += batch;
+        stats.merge(RunningStats(part.actual_samples, part.mean, part.variance));
+
+        if (stats.count() > 1 && stats.std_error() <= target_stderr) {
+            break;
+        }
+
+        // Values needed for the target: n ≥ σ²/target², converted to f-calls with the
+        // engine's observed ratio of f-calls per returned value (2 for antithetic pairs)
+        double per_value = stats.count() > 0
+            ? static_cast<double>(used) / static_cast<double>(stats.count()) : 1.0;
+        double needed = stats.variance() / (target_stderr * target_stderr) * per_value;
+
+        // Remaining f-calls plus 12.5% headroom, clamped in double before the conversion:
+        // a tiny target can ask for more than a long long holds (or +inf)
+        double more = needed - static_cast<double>(used);
+        more += more / 8.0;
+        if (!(more < static_cast<double>(kMaxBatch))) {
+            more = static_cast<double>(kMaxBatch);
+        }
+        next_batch = std::max(kMinBatch, static_cast<long long>(std::ceil(more)));
+    }
+
+    TargetEstimate result;
+    result.estimate.actual_samples = static_cast<int>(std::min<long long>(stats.count(), INT_MAX));
+    result.estimate.mean      = stats.mean();
+    result.estimate.variance  = stats.variance();
+    result.estimate.std_error = stats.std_error();
+    result.samples_used = used;
+    result.target_met   = stats.count() > 1 && stats.std_error() <= target_stderr;
+    return result;
+}
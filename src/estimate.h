@@ -0,0 +1,53 @@
+#ifndef ESTIMATE_H
+#define ESTIMATE_H
+
+#include "engine.h"   // base Engine
+#include <functional> // for std::function
+
+// Final statistics of one run, without the per-sample log that main() writes.
+struct Estimate {
+    int actual_samples;   // number of values averaged
+    double mean;          // estimate of π
+    double variance;      // unbiased sample variance of the values
+    double std_error;     // standard error of the mean
+};
+
+// One step of the reduction in run_estimate(), for per-value logging and progress.
+struct ReductionStep {
+    long long n;            // values reduced so far (0: sampling done, reduction starting)
+    long long total;        // values returned by the engine
+    const Sample* sample;   // full mode: the n-th Sample; compact mode: nullptr
+    long long hits;         // compact mode: hits among the first n draws
+    double mean;            // running statistics over the first n values
+    double variance;
+    double std_error;
+};
+
+// Called with n = 0 once sampling is done, then after every value (full mode) or every
+// 64-draw word (compact mode).
+using ReductionCallback = std::function<void(const ReductionStep&)>;
+
+// Draw `samples` from `engine` and reduce them to an Estimate.
+// With `compact` and an indicator engine, draws are bit-packed and reduced by popcount
+// (see hit_stats.h); otherwise Welford's RunningStats is used.  `on_step`, if set, sees the
+// running statistics as the reduction proceeds (main() writes results.log from it).
+Estimate run_estimate(Engine& engine, int samples, bool compact,
+                      const ReductionCallback& on_step = ReductionCallback());
+
+// Result of run_to_target().
+struct TargetEstimate {
+    Estimate estimate;        // statistics over all batches (actual_samples ≤ INT_MAX)
+    long long samples_used;   // f-calls requested from the engine
+    bool target_met;          // std_error ≤ target before the cap was reached
+};
+
+// Run `engine` in batches until the standard error is ≤ `target_stderr`, or until
+// `max_samples` f-calls have been requested.  After each batch the number of further
+// f-calls needed is predicted from the current variance (stderr² = σ²/n); batches are
+// even perfect squares of at most 2^22 f-calls, so memory stays bounded for any target.
+// Batches are merged with RunningStats::merge; engines that estimate coefficients
+// (control variates) therefore estimate them per batch.
+TargetEstimate run_to_target(Engine& engine, double target_stderr, long long max_samples,
+                             bool compact);
+
+#endif // ESTIMATE_H
@@ -1,16 +1,20 @@
 #include "exponential_engine.h"
 #include <cmath>
-#include <random>
 
 ExponentialEngine::ExponentialEngine(double lambda_)
     : lambda(lambda_)
 {
-    std::random_device rd;
-    rng = std::mt19937(rd());
+    // Nondeterministic seed until seed() is called
+    rng = random_stream();
 }
 
 ExponentialEngine::~ExponentialEngine() {}
 
+// seed(): restart at (seed, stream, offset); see rng_streams.h
+void ExponentialEngine::seed(std::uint64_t seed_value, std::uint64_t stream, std::uint64_t offset) {
+    rng = RngStream(seed_value, stream, offset);
+}
+
 void ExponentialEngine::sample(int samples, std::vector<Sample>& outputs) {
     // PDF p(x,y) = [λ e^{-λx}/(1-e^{-λ})] * [λ e^{-λy}/(1-e^{-λ})]
     // so weight = 4·I[x^2+y^2≤1] / p(x,y)
@@ -18,17 +22,16 @@ void ExponentialEngine::sample(int samples, std::vector<Sample>& outputs) {
     outputs.clear();
     outputs.reserve(static_cast<size_t>(samples));
 
-    std::uniform_real_distribution<double> uni(0.0, 1.0);
     double Z = 1.0 - std::exp(-lambda); 
     // normalizing factor for each coordinate over [0,1] is (1 - e^{-λ})
 
     for (int i = 0; i < samples; ++i) {
         // draw x via inverse‐cdf of truncated exp(λ) on [0,1]
-        double U1 = uni(rng);
+        double U1 = uniform01(rng);
         double x  = -std::log(1.0 - U1 * Z) / lambda;
 
         // draw y similarly
-        double U2 = uni(rng);
+        double U2 = uniform01(rng);
         double y  = -std::log(1.0 - U2 * Z) / lambda;
 
         Sample s;
@@ -2,7 +2,7 @@
 #define EXPONENTIAL_ENGINE_H
 
 #include "engine.h"
-#include <random>
+#include "rng_streams.h"  // RngStream (counter-based, seekable PRNG)
 
 // ExponentialEngine: Importance Sampling via p(x,y) ∝ e^{-λ(x+y)} truncated to [0,1]^2.
 class ExponentialEngine : public Engine {
@@ -16,8 +16,11 @@ public:
     // Sample up to `samples` points in [0,1]^2, each weighted by f/p
     void sample(int samples, std::vector<Sample>& outputs) override;
 
+    // Restart the PRNG at (seed, stream, offset) of the stream registry (see Engine::seed).
+    void seed(std::uint64_t seed_value, std::uint64_t stream, std::uint64_t offset) override;
+
 private:
-    std::mt19937 rng;   // Mersenne Twister RNG
+    RngStream rng;      // Philox stream, addressed by (seed, stream, offset)
     double lambda;      // rate parameter for the truncated exponential
 };
 
@@ -0,0 +1,32 @@
+#include "hit_stats.h"  // corresponding header
+#include <cmath>        // for std::sqrt
+
+// count_hits(): sum of popcounts over all packed words
+long long count_hits(const std::vector<std::uint64_t>& words) {
+    long long hits = 0;
+    for (std::uint64_t w : words) {
+        hits += popcount64(w);
+    }
+    return hits;
+}
+
+// hit_statistics(): exact sample moments of a scaled Bernoulli from its hit count
+HitStats hit_statistics(long long samples, long long hits, double scale) {
+    HitStats s{ samples, hits, 0.0, 0.0, 0.0 };
+    if (samples <= 0) {
+        return s;
+    }
+
+    double n = static_cast<double>(samples);
+    double k = static_cast<double>(hits);
+
+    // mean = scale · k / n
+    s.mean = scale * k / n;
+
+    // Σ (v_i − mean)² = scale² · k (n − k) / n, divided by (n − 1) for the unbiased variance
+    if (samples > 1) {
+        s.variance  = scale * scale * k * (n - k) / (n * (n - 1.0));
+        s.std_error = std::sqrt(s.variance / n);
+    }
+    return s;
+}
@@ -0,0 +1,42 @@
+#ifndef HIT_STATS_H
+#define HIT_STATS_H
+
+#include <cstdint>  // for std::uint64_t
+#include <vector>   // for std::vector
+
+// Exact statistics for bit-packed indicator results (see Engine::sample_hits).
+//
+// Every value of an indicator engine is either `scale` (hit) or 0 (miss), i.e. a scaled
+// Bernoulli.  With n draws and k hits the sample moments follow in closed form:
+//   mean     = scale · k / n
+//   variance = scale² · k (n − k) / (n (n − 1))      (unbiased, n > 1)
+//   stderr   = sqrt(variance / n)
+// so no per-sample Welford update is needed — only a popcount over the packed words.
+struct HitStats {
+    long long samples;  // n, number of draws
+    long long hits;     // k, number of set bits
+    double mean;        // running estimate of π
+    double variance;    // unbiased sample variance of the values
+    double std_error;   // standard error of the mean
+};
+
+// Number of set bits in a 64-bit word (hardware popcount where the compiler provides it).
+inline int popcount64(std::uint64_t w) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(w);
+#else
+    // Portable SWAR fallback
+    w = w - ((w >> 1) & 0x5555555555555555ULL);
+    w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+    w = (w + (w >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<int>((w * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// Total number of set bits in `words`.
+long long count_hits(const std::vector<std::uint64_t>& words);
+
+// Closed-form mean / variance / stderr for `hits` hits out of `samples` draws of value `scale`.
+HitStats hit_statistics(long long samples, long long hits, double scale = 4.0);
+
+#endif // HIT_STATS_H
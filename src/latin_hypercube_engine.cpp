@@ -0,0 +1,167 @@
+#include "latin_hypercube_engine.h"
+#include <algorithm>  // for std::min
+#include <thread>     // for std::thread
+#include <vector>     // for std::vector
+
+namespace {
+
+// Keyed pseudo-random permutation of {0,…,size-1}.
+// A mixed-radix 4-round Feistel network permutes {0,…,a·b-1}, viewing v = high·b + low with
+// high ∈ [0,a), low ∈ [0,b), a = ⌈√size⌉ and b = ⌈size/a⌉.  Rounds alternately add a keyed
+// hash of one half to the other, modulo that half's radix, which is invertible.  Since
+// size ≤ a·b < size + a, values that land outside [0,size) are rare (probability < 1/√size)
+// and are re-encrypted ("cycle walking") until they fall inside, which restricts the
+// bijection to [0,size).  A power-of-two domain would need up to 2 encryptions per lookup.
+class FeistelPermutation {
+public:
+    FeistelPermutation(std::uint64_t size_, std::uint64_t key)
+        : size(size_)
+    {
+        high_radix = 1;
+        while (high_radix * high_radix < size) {
+            ++high_radix;
+        }
+        low_radix = (size + high_radix - 1) / high_radix;
+        for (int r = 0; r < kRounds; ++r) {
+            round_keys[r] = mix64(key + 0x9E3779B97F4A7C15ULL * static_cast<std::uint64_t>(r + 1));
+        }
+    }
+
+    // π(i) for i ∈ [0, size)
+    std::uint64_t operator()(std::uint64_t i) const {
+        do {
+            i = encrypt(i);
+        } while (i >= size);
+        return i;
+    }
+
+private:
+    static constexpr int kRounds = 4;
+
+    // Keyed hash of `v` reduced to [0, radix) by a multiply-shift (no division)
+    std::uint64_t round_function(std::uint64_t v, int r, std::uint64_t radix) const {
+        return ((mix64(v ^ round_keys[r]) & 0xFFFFFFFFULL) * radix) >> 32;
+    }
+
+    // (x + y) mod radix for x, y < radix
+    static std::uint64_t add_mod(std::uint64_t x, std::uint64_t y, std::uint64_t radix) {
+        std::uint64_t z = x + y;
+        return z >= radix ? z - radix : z;
+    }
+
+    std::uint64_t encrypt(std::uint64_t v) const {
+        std::uint64_t high = v / low_radix;
+        std::uint64_t low  = v - high * low_radix;
+        for (int r = 0; r < kRounds; r += 2) {
+            high = add_mod(high, round_function(low,  r,     high_radix), high_radix);
+            low  = add_mod(low,  round_function(high, r + 1, low_radix),  low_radix);
+        }
+        return high * low_radix + low;
+    }
+
+    std::uint64_t size;                 // permutation domain size M
+    std::uint64_t high_radix;           // a = ⌈√M⌉
+    std::uint64_t low_radix;            // b = ⌈M/a⌉
+    std::uint64_t round_keys[kRounds];  // per-round keys derived from `key`
+};
+
+} // namespace
+
+LatinHypercubeEngine::LatinHypercubeEngine(bool antithetic_, int max_threads_)
+    : antithetic(antithetic_), max_threads(max_threads_)
+{
+    // Nondeterministic seed until seed() is called
+    rng = random_stream();
+}
+
+LatinHypercubeEngine::~LatinHypercubeEngine() { }
+
+// seed(): restart at (seed, stream, offset); see rng_streams.h
+void LatinHypercubeEngine::seed(std::uint64_t seed_value, std::uint64_t stream, std::uint64_t offset) {
+    rng = RngStream(seed_value, stream, offset);
+}
+
+void LatinHypercubeEngine::sample(int n, std::vector<Sample>& outputs) {
+    // 1) Number of strata per axis (= number of returned Samples)
+    const int M = antithetic ? n / 2 : n;
+
+    outputs.clear();
+    if (M <= 0) {
+        return;
+    }
+    outputs.resize(static_cast<size_t>(M));  // blocks write disjoint ranges in parallel
+
+    // 2) Fresh permutation keys for πx, πy and a key for the per-block streams
+    auto draw64 = [this]() {
+        return (static_cast<std::uint64_t>(rng()) << 32) | static_cast<std::uint64_t>(rng());
+    };
+    const FeistelPermutation perm_x(static_cast<std::uint64_t>(M), draw64());
+    const FeistelPermutation perm_y(static_cast<std::uint64_t>(M), draw64());
+    const std::uint64_t run_key = draw64();
+
+    // 3) Block layout: the last block may be short
+    const int B = kBlockSize;
+    const int blocks = (M + B - 1) / B;
+
+    // 4) Fill blocks [first, last): evaluate the block's strata, then draw one point per stratum
+    auto fill_blocks = [&](int first, int last) {
+        std::vector<std::uint32_t> strata_x(static_cast<size_t>(B)), strata_y(static_cast<size_t>(B));
+        for (int b = first; b < last; ++b) {
+            const int begin = b * B;
+            const int len = std::min(B, M - begin);
+
+            // 4a) πx(i), πy(i) for every i in this block
+            for (int k = 0; k < len; ++k) {
+                strata_x[k] = static_cast<std::uint32_t>(perm_x(static_cast<std::uint64_t>(begin + k)));
+                strata_y[k] = static_cast<std::uint32_t>(perm_y(static_cast<std::uint64_t>(begin + k)));
+            }
+
+            // 4b) Independent stream for this block, determined by (run key, block index)
+            RngStream block_rng(run_key, sub_stream_id(rng.stream(), static_cast<std::uint64_t>(b)));
+
+            for (int k = 0; k < len; ++k) {
+                // Uniform point inside the (πx(i), πy(i)) stratum cell
+                double x = (static_cast<double>(strata_x[k]) + uniform01(block_rng)) / static_cast<double>(M);
+                double y = (static_cast<double>(strata_y[k]) + uniform01(block_rng)) / static_cast<double>(M);
+
+                // f(x,y) = 4·I{x^2 + y^2 ≤ 1}
+                double val = (x * x + y * y) <= 1.0 ? 4.0 : 0.0;
+
+                // Antithetic partner (1−x, 1−y), averaged with the original
+                if (antithetic) {
+                    double x2 = 1.0 - x;
+                    double y2 = 1.0 - y;
+                    double f2 = (x2 * x2 + y2 * y2) <= 1.0 ? 4.0 : 0.0;
+                    val = 0.5 * (val + f2);
+                }
+
+                outputs[static_cast<size_t>(begin + k)] = Sample{ x, y, val };
+            }
+        }
+    };
+
+    // 5) Split the blocks into contiguous chunks, one per thread: at most max_threads (or one
+    //    per hardware thread), and only as many as have kMinBlocksPerThread blocks each
+    int threads = max_threads;
+    if (threads <= 0) {
+        unsigned hw = std::thread::hardware_concurrency();
+        threads = hw > 0 ? static_cast<int>(hw) : 1;
+    }
+    threads = std::min(threads, blocks / kMinBlocksPerThread);
+
+    if (threads <= 1) {
+        fill_blocks(0, blocks);
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(static_cast<size_t>(threads));
+    for (int t = 0; t < threads; ++t) {
+        int first = static_cast<int>(static_cast<long long>(blocks) * t / threads);
+        int last  = static_cast<int>(static_cast<long long>(blocks) * (t + 1) / threads);
+        workers.emplace_back(fill_blocks, first, last);
+    }
+    for (std::thread& w : workers) {
+        w.join();
+    }
+}
@@ -0,0 +1,62 @@
+#ifndef LATIN_HYPERCUBE_ENGINE_H
+#define LATIN_HYPERCUBE_ENGINE_H
+
+#include "engine.h"     // defines struct Sample { double x, y, value; };
+#include <cstdint>      // for std::uint64_t
+#include "rng_streams.h"  // RngStream (counter-based, seekable PRNG)
+
+// LatinHypercubeEngine: Latin hypercube sampling (LHS) in [0,1]^2 for any N.
+//
+//   Each axis is cut into M equal strata and every stratum of x and every stratum of y
+//   is used by exactly one sample:  x_i = (πx(i) + u_i)/M,  y_i = (πy(i) + v_i)/M,
+//   where πx, πy are random permutations of {0,…,M-1}.  Unlike StratifiedEngine, M need
+//   not be a perfect square.
+//
+//   Streaming block permutations:
+//     πx and πy are never materialized.  Each is a keyed pseudo‐random permutation
+//     (a 4‐round mixed‐radix Feistel network on an a × b grid, a = ⌈√M⌉, b = ⌈M/a⌉, with
+//     "cycle walking" to stay inside {0,…,M-1}), so π(i) can be evaluated for any i in
+//     O(1) time and memory; since a·b < M + a, almost every lookup is one encryption.
+//     Sample indices are processed in blocks of kBlockSize: the strata of a block are
+//     evaluated into two cache‐sized scratch buffers, then the points are drawn.
+//     Extra memory is O(kBlockSize · threads), independent of N.
+//
+//   Blocks are independent, so they are filled in parallel; each block draws its in‐stratum
+//   offsets from its own Philox sub-stream keyed by (run key, block index), which keeps results
+//   independent of the number of threads.
+//
+//   antithetic: pair (x,y) with (1−x,1−y), as in AntitheticEngine.  n is the number of
+//   f‐calls, M = ⌊n/2⌋ pairs are stratified and ⌊n/2⌋ Samples returned, each with
+//   value = [f(x,y) + f(1−x,1−y)]/2.  (The reflected points form a Latin hypercube too.)
+class LatinHypercubeEngine : public Engine {
+public:
+    // Number of samples per block (two stratum buffers of this size per thread)
+    static constexpr int kBlockSize = 4096;
+
+    // Fewest blocks worth a thread of their own: smaller runs (e.g. Auto pilots) stay on
+    // the calling thread, since starting threads would cost more than it saves
+    static constexpr int kMinBlocksPerThread = 32;
+
+    // Constructor: seed the RNG, optionally use antithetic pairs.  `max_threads` caps the
+    // threads per sample() call (0 = one per hardware thread); callers that already run
+    // engines on a pool of threads pass 1.
+    LatinHypercubeEngine(bool antithetic_ = false, int max_threads_ = 0);
+
+    // Destructor: nothing special
+    ~LatinHypercubeEngine();
+
+    // sample(n, outputs):
+    //   – plain:       outputs.size() == n
+    //   – antithetic:  outputs.size() == ⌊n/2⌋
+    void sample(int n, std::vector<Sample>& outputs) override;
+
+    // Restart the PRNG at (seed, stream, offset) of the stream registry (see Engine::seed).
+    void seed(std::uint64_t seed_value, std::uint64_t stream, std::uint64_t offset) override;
+
+private:
+    RngStream rng;  // Philox stream (permutation keys and block keys)
+    bool antithetic;   // pair (x,y) with (1−x,1−y)
+    int max_threads;   // cap on block-filling threads, 0 = hardware concurrency
+};
+
+#endif // LATIN_HYPERCUBE_ENGINE_H
@@ -1,147 +1,217 @@
 #include <iostream>             // for std::cout, std::cerr
-#include <vector>               // for std::vector
 #include <memory>               // for std::unique_ptr, std::make_unique
 #include <string>               // for std::string
-#include <cmath>                // for std::sqrt
 #include <fstream>              // for std::ofstream
-#include <iomanip>              // for std::fixed, std::setprecision
+#include <iomanip>              // for std::fixed, std::setprecision, std::setw
+#include <cstdint>              // for std::uint64_t
+#include <cstdlib>              // for std::atoi
 
 #include "engine.h"             // base Engine + Sample
-#include "random_engine.h"      // RandomEngine
-#include "stratified_engine.h"  // StratifiedEngine
-#include "exponential_engine.h" // ExponentialEngine
-#include "antithetic_engine.h"  // AntitheticEngine
-#include "control_variate_engine.h" // ControlVariateEngine
-#include "control_antithetic_engine.h" // ControlAntitheticEngine
+#include "engine_registry.h"    // make_engine
+#include "auto_engine.h"        // select_engine (ENGINE = Auto)
+#include "controls.h"           // find_controls
+#include "estimate.h"           // run_estimate, ReductionStep
+#include "progress.h"           // ProgressPublisher (PROGRESS = /name)
+#include "rng_streams.h"        // random_seed, shard_stream_id (SEED, STREAM_SHARD/OFFSET)
 #include "utils.h"              // read_config, trim
+#ifdef VR_HAVE_SERVICE
+#include "service.h"            // run_service (--serve)
+#endif
+
+int main(int argc, char* argv[]) {
+#ifdef VR_HAVE_SERVICE
+    // 0) monte_carlo_pi --serve [SOCKET_PATH] [--workers N]: long-running service, no input.in
+    if (argc > 1 && std::string(argv[1]) == "--serve") {
+        std::string socket_path = kDefaultSocketPath;
+        int workers = 0;   // 0 = one per hardware thread
+        for (int a = 2; a < argc; ++a) {
+            std::string arg = argv[a];
+            if (arg == "--workers" && a + 1 < argc) {
+                workers = std::atoi(argv[++a]);
+            } else if (!arg.empty() && arg[0] != '-') {
+                socket_path = arg;
+            } else {
+                std::cerr << "Usage: " << argv[0] << " --serve [SOCKET_PATH] [--workers N]\n";
+                return 1;
+            }
+        }
+        return run_service(socket_path, workers);
+    }
+#else
+    (void)argc;
+    (void)argv;
+#endif
 
-int main() {
     // 1) Read configuration from "input.in"
-    std::string engine_name;     // Will hold e.g. "Random" or "Stratified"
-    int requested_samples = 0;   // Will hold the integer that user wants
-
-    // Call updated read_config that also fills `lambda`
-    if (!read_config("input.in", engine_name, requested_samples)) {
+    Config config;
+    if (!read_config("input.in", config)) {
         // If it fails (missing ENGINE or SAMPLES, or parse error), exit with error
         return 1;
     }
+    std::string engine_name = config.engine;   // e.g. "Random" or "Stratified"
+    int requested_samples = config.samples;    // the integer that user wants
+    int engine_samples = requested_samples;    // the engine's budget (less the pilots for Auto)
 
-    // 2) Instantiate the chosen engine (as a unique_ptr to base class)
-    std::unique_ptr<Engine> engine_ptr;
-
-    if (engine_name == "Random") {
-        // Now using std::make_unique (C++14)
-        engine_ptr = std::make_unique<RandomEngine>();
-    }
-    else if (engine_name == "Stratified") {
-        engine_ptr = std::make_unique<StratifiedEngine>();
-    }
-    else if (engine_name == "Exponential") {
-        double lambda = 0.6;   // hard-coded value
-        engine_ptr = std::make_unique<ExponentialEngine>(lambda);
-    }
-    else if (engine_name == "Antithetic") {
-        engine_ptr = std::make_unique<AntitheticEngine>();
+    // Engine parameters from the config (CONTROLS for the MultiControl engines)
+    EngineOptions options;
+    if (!find_controls(config.controls, options.controls)) {
+        return 1;
     }
-    else if (engine_name == "ControlVariate") {
-        engine_ptr = std::make_unique<ControlVariateEngine>();
+
+    // Live progress snapshot in shared memory, if PROGRESS is set (see progress.h)
+    ProgressPublisher progress;
+    if (!config.progress.empty()) {
+        progress.open(config.progress, engine_name, requested_samples, config.target_stderr);
     }
-    else if (engine_name == "ControlAntithetic") {
-        engine_ptr = std::make_unique<ControlAntitheticEngine>();
+
+    // Run seed: SEED from the config, or a fresh one that is reported so the run can be replayed
+    const std::uint64_t seed = config.has_seed ? config.seed : random_seed();
+
+    // 2a) ENGINE = Auto: pilot every registered engine and keep the most efficient one;
+    //     the pilots' f-calls are deducted from the SAMPLES budget.
+    bool auto_selected = (engine_name == "Auto");
+    AutoSelection selection;
+    if (auto_selected) {
+        selection = select_engine(requested_samples, options, seed);
+        engine_name = selection.winner;
+        engine_samples = selection.remaining_samples;
+        progress.set_engine(engine_name);
     }
-    else {
+
+    // 2b) Instantiate the chosen engine (as a unique_ptr to base class) from the registry
+    std::unique_ptr<Engine> engine_ptr = make_engine(engine_name, options);
+    if (!engine_ptr) {
         std::cerr << "Error: Unknown ENGINE \"" << engine_name << "\" in config.\n";
         return 1;
     }
 
-    // 3) Collect all samples into a vector<Sample>
-    std::vector<Sample> samples;           // Each Sample holds (x,y,value)
-    engine_ptr->sample(requested_samples, samples);
-    int actual_samples = static_cast<int>(samples.size());  // May differ if stratified adjusted
+    // Each engine draws from its own registry stream, so the same SEED never couples engines
+    engine_ptr->seed(seed, shard_stream_id(engine_name, config.stream_shard), config.stream_offset);
 
-    // 4) Open results.log for appending so we can log per-sample info
+    // Compact results mode is only meaningful for pure indicator engines
+    bool compact = config.compact;
+    if (compact && !engine_ptr->supports_hits()) {
+        std::cerr << "Warning: RESULTS = Compact is not supported by ENGINE \"" << engine_name
+                  << "\"; using Full results.\n";
+        compact = false;
+    }
+
+    // 3) Open results.log for appending so we can log per-sample info
     std::ofstream logfile("results.log", std::ios::app);
     if (!logfile.is_open()) {
         std::cerr << "Warning: Could not open results.log for writing.\n";
-    } else {
-        // Write a header for this run
-        logfile << "# Engine: " << engine_name
-                << "  Requested: " << requested_samples
-                << "  Actual: " << actual_samples << "\n";
-        logfile << "# n  x       y       value    mean     var      stderr\n";
-        logfile << std::fixed << std::setprecision(6);
     }
 
-    // 5) Initialize Welford’s algorithm for running mean & M2
-    // This is a one-pass, on-the-fly computation of the mean and variances.
-    // It gives a similar numerical accuracy compared to the usual two-pass version, calculated as:
-    //    i) mean = sum(x_i) / N
-    //    ii) var = sum(x - mean)^2 / (N-1)
-
-    double mean = 0.0;     // running mean of the integrand values
-    double M2 = 0.0;       // running sum of squared deviations
-    // At step n: variance = M2/(n-1) for n>1; for n=1 we set var=0
-
-    // 6) Loop over each sample index and update online stats + log
-    for (int i = 0; i < actual_samples; ++i) {
-        // Current Sample struct
-        double x     = samples[i].x;      // x-coordinate
-        double y     = samples[i].y;      // y-coordinate
-        double value = samples[i].value;  // integrand = 4 or 0
-
-        int n = i + 1;  // current sample count
-
-        // 6a) Welford update for mean & M2
-        double delta = value - mean;
-        mean += delta / static_cast<double>(n);   // new running mean
-        double delta2 = value - mean;
-        M2 += delta * delta2;                     // accumulate sum of squares
-
-        // 6b) Compute sample variance (unbiased) for n>1; else 0.0
-        double variance = 0.0;
-        if (n > 1) {
-            variance = M2 / static_cast<double>(n - 1);
+    // 4) Run the engine; the library reduces the values (estimate.h) and reports every step
+    //    to this callback, which writes results.log and publishes progress
+    progress.publish(kPhaseSampling, 0, 0.0, 0.0, 0.0);
+    auto on_step = [&](const ReductionStep& step) {
+        // 4a) Sampling done: the engine's actual count is known, write the run header
+        if (step.n == 0) {
+            progress.set_total(step.total);
+            if (logfile.is_open()) {
+                logfile << "# Engine: " << engine_name
+                        << "  Requested: " << requested_samples;
+                if (auto_selected) {
+                    logfile << "  Engine Budget: " << engine_samples;
+                }
+                logfile << "  Actual: " << step.total
+                        << (compact ? "  Results: Compact" : "")
+                        << "  Seed: " << seed
+                        << "  Stream Registry: v" << kStreamRegistryVersion
+                        << "  Shard: " << config.stream_shard
+                        << "  Offset: " << config.stream_offset << "\n";
+                logfile << (compact ? "# n  hits     mean     var      stderr\n"
+                                    : "# n  x       y       value    mean     var      stderr\n");
+                logfile << std::fixed << std::setprecision(6);
+            }
+            return;
         }
 
-        // 6c) Compute standard error = sqrt(variance / n) if n>1; else 0
-        double std_error = 0.0;
-        if (n > 1) {
-            std_error = std::sqrt(variance / static_cast<double>(n));
+        // 4b) Publish progress every kPublishInterval samples (a mask test, no syscalls);
+        //     compact steps come once per 64 draws, so test the word boundary instead
+        long long interval_steps = compact ? kPublishInterval / 64 : kPublishInterval;
+        long long index = compact ? (step.n + 63) / 64 : step.n;
+        if ((index & (interval_steps - 1)) == 0) {
+            progress.publish(kPhaseAccumulating, step.n, step.mean, step.variance, step.std_error);
         }
 
-        // 6d) Append to logfile if it’s open, all with 6 decimal places
-        if (logfile.is_open()) {
-            logfile << n << "  "
-                    << x        << "  "
-                    << y        << "  "
-                    << value    << "  "
-                    << mean     << "  "
-                    << variance << "  "
-                    << std_error<< "\n";
+        // 4c) Append to logfile if it’s open, all with 6 decimal places
+        if (!logfile.is_open()) {
+            return;
         }
-    }
+        if (compact) {
+            logfile << step.n    << "  " << step.hits << "  ";
+        } else {
+            logfile << step.n         << "  "
+                    << step.sample->x << "  "       // x-coordinate
+                    << step.sample->y << "  "       // y-coordinate
+                    << step.sample->value << "  ";  // integrand = 4 or 0
+        }
+        logfile << step.mean     << "  "
+                << step.variance << "  "
+                << step.std_error<< "\n";
+    };
+    Estimate estimate = run_estimate(*engine_ptr, engine_samples, compact, on_step);
 
-    // 7) Close logfile
+    // 5) Close logfile
     if (logfile.is_open()) {
         logfile.close();
     }
 
-    // 8) Compute final variance & std_error for console output
-    double final_variance = 0.0;
-    double final_std_error = 0.0;
-    if (actual_samples > 1) {
-        final_variance = M2 / static_cast<double>(actual_samples - 1);
-        final_std_error = std::sqrt(final_variance / static_cast<double>(actual_samples));
+    int actual_samples = estimate.actual_samples;  // May differ from requested (e.g. stratified, antithetic)
+    double mean = estimate.mean;                   // final estimate of π
+    double final_variance = estimate.variance;     // unbiased sample variance of the values
+    double final_std_error = estimate.std_error;   // standard error of the mean
+
+    // An estimate from zero draws is meaningless (e.g. SAMPLES = 0 or too few for the engine)
+    if (actual_samples == 0) {
+        std::cerr << "Error: ENGINE \"" << engine_name << "\" drew no samples from a budget of "
+                  << engine_samples << "; increase SAMPLES.\n";
+        return 1;
     }
 
-    // 9) Print summary to console with fixed precision (six decimals)
+    // Final snapshot for monitoring
+    progress.publish(kPhaseDone, actual_samples, mean, final_variance, final_std_error);
+
+    // 6) Print summary to console with fixed precision (six decimals)
     std::cout << std::fixed << std::setprecision(8);
     std::cout << "Engine:            " << engine_name          << "\n";
     std::cout << "Requested Samples: " << requested_samples    << "\n";
+    if (auto_selected) {
+        std::cout << "Engine Budget:     " << engine_samples
+                  << " (SAMPLES less the Auto pilots)\n";
+    }
     std::cout << "Actual Samples:    " << actual_samples       << "\n";
+    std::cout << "Results:           " << (compact ? "Compact" : "Full") << "\n";
+    std::cout << "Seed:              " << seed
+              << " (stream registry v" << kStreamRegistryVersion
+              << ", shard " << config.stream_shard
+              << ", offset " << config.stream_offset << ")\n";
     std::cout << "Final Estimate π:  " << mean                  << "\n";
     std::cout << "Final Variance:    " << final_variance        << "\n";
     std::cout << "Final Std. Error:  " << final_std_error       << "\n";
 
+    // 7) ENGINE = Auto: report the decision and every pilot measurement
+    if (auto_selected && selection.pilots.empty()) {
+        std::cout << "Auto Selection:    " << selection.winner
+                  << " (pilots skipped: SAMPLES too small)\n";
+    } else if (auto_selected) {
+        std::cout << "Auto Selection:    " << selection.winner
+                  << " (pilot samples: " << selection.pilot_samples << ")\n";
+        std::cout << std::scientific << std::setprecision(4);
+        std::cout << "  " << std::left << std::setw(30) << "Pilot Engine"
+                  << std::right << std::setw(12) << "Variance"
+                  << std::setw(12) << "Sec/Sample"
+                  << std::setw(12) << "Var*Sec" << "\n";
+        for (const PilotResult& p : selection.pilots) {
+            std::cout << (p.name == selection.winner ? "* " : "  ")
+                      << std::left << std::setw(30) << p.name
+                      << std::right << std::setw(12) << p.variance
+                      << std::setw(12) << p.cost
+                      << std::setw(12) << p.efficiency << "\n";
+        }
+    }
+
     return 0;
 }
@@ -0,0 +1,154 @@
+#include "multi_control_engine.h"
+
+namespace {
+
+// Centered (pair-averaged if antithetic) controls d_j = g_j − E[g_j] for the selected indices
+inline void centered_controls(double x, double y, bool antithetic,
+                              const std::vector<int>& controls, const double* means,
+                              double* d_out) {
+    double g[kNumControls];
+    evaluate_controls(x, y, g);
+    if (antithetic) {
+        double g2[kNumControls];
+        evaluate_controls(1.0 - x, 1.0 - y, g2);
+        for (int j = 0; j < kNumControls; ++j) {
+            g[j] = 0.5 * (g[j] + g2[j]);
+        }
+    }
+    for (size_t j = 0; j < controls.size(); ++j) {
+        d_out[j] = g[controls[j]] - means[controls[j]];
+    }
+}
+
+// Solve the symmetric positive semi-definite system A β = b (k ≤ kNumControls) by Gaussian
+// elimination without row swaps.  A pivot that has shrunk below `tol` times its original
+// diagonal marks a constant or linearly dependent control; it is dropped (β_j = 0).
+void solve_least_squares(double A[kNumControls][kNumControls], double* b, int k, double* beta) {
+    constexpr double tol = 1e-10;
+    double diag[kNumControls];
+    bool active[kNumControls];
+    for (int j = 0; j < k; ++j) {
+        diag[j] = A[j][j];
+        active[j] = true;
+    }
+
+    // Forward elimination over active pivots
+    for (int j = 0; j < k; ++j) {
+        if (!(A[j][j] > tol * diag[j]) || diag[j] <= 0.0) {
+            active[j] = false;
+            continue;
+        }
+        for (int i = j + 1; i < k; ++i) {
+            double factor = A[i][j] / A[j][j];
+            for (int l = j; l < k; ++l) {
+                A[i][l] -= factor * A[j][l];
+            }
+            b[i] -= factor * b[j];
+        }
+    }
+
+    // Back substitution; dropped controls contribute nothing
+    for (int j = k - 1; j >= 0; --j) {
+        if (!active[j]) {
+            beta[j] = 0.0;
+            continue;
+        }
+        double sum = b[j];
+        for (int l = j + 1; l < k; ++l) {
+            sum -= A[j][l] * beta[l];
+        }
+        beta[j] = sum / A[j][j];
+    }
+}
+
+} // namespace
+
+MultiControlEngine::MultiControlEngine(const std::vector<int>& controls_, bool antithetic_)
+    : controls(controls_), antithetic(antithetic_)
+{
+    // Nondeterministic seed until seed() is called
+    rng = random_stream();
+}
+
+MultiControlEngine::~MultiControlEngine() { }
+
+// seed(): restart at (seed, stream, offset); see rng_streams.h
+void MultiControlEngine::seed(std::uint64_t seed_value, std::uint64_t stream, std::uint64_t offset) {
+    rng = RngStream(seed_value, stream, offset);
+}
+
+void MultiControlEngine::sample(int n, std::vector<Sample>& outputs) {
+    const int k = static_cast<int>(controls.size());
+    const double* means = control_means().data();
+
+    // 1) Number of returned samples: one per draw, or one per antithetic pair
+    const int M = antithetic ? n / 2 : n;
+
+    outputs.clear();
+    outputs.reserve(static_cast<size_t>(M));
+
+    // 2) Streaming moment sums (fixed size, no per-sample storage besides `outputs`):
+    //    S_f = Σ f,  S_d[j] = Σ d_j,  S_fd[j] = Σ f·d_j,  S_dd[j][l] = Σ d_j·d_l
+    double S_f = 0.0;
+    double S_d[kNumControls] = {};
+    double S_fd[kNumControls] = {};
+    double S_dd[kNumControls][kNumControls] = {};
+
+    double d[kNumControls];
+
+    // 3) First pass: draw, evaluate f and the controls, accumulate the moments
+    for (int i = 0; i < M; ++i) {
+        double x = uniform01(rng);
+        double y = uniform01(rng);
+
+        // f = 4·I{x^2 + y^2 ≤ 1}, pair-averaged with (1−x, 1−y) if antithetic
+        double f = (x * x + y * y) <= 1.0 ? 4.0 : 0.0;
+        if (antithetic) {
+            double x2 = 1.0 - x;
+            double y2 = 1.0 - y;
+            f = 0.5 * (f + ((x2 * x2 + y2 * y2) <= 1.0 ? 4.0 : 0.0));
+        }
+
+        centered_controls(x, y, antithetic, controls, means, d);
+
+        S_f += f;
+        for (int j = 0; j < k; ++j) {
+            S_d[j]  += d[j];
+            S_fd[j] += f * d[j];
+            for (int l = j; l < k; ++l) {
+                S_dd[j][l] += d[j] * d[l];
+            }
+        }
+
+        outputs.push_back(Sample{ x, y, f });
+    }
+
+    // 4) Sample covariances (denominator M−1): Σ_dd and Σ_df
+    beta.assign(static_cast<size_t>(k), 0.0);
+    if (M < 2 || k == 0) {
+        return;
+    }
+    double N = static_cast<double>(M);
+    double A[kNumControls][kNumControls];
+    double b[kNumControls];
+    for (int j = 0; j < k; ++j) {
+        b[j] = (S_fd[j] - S_f * S_d[j] / N) / (N - 1.0);
+        for (int l = j; l < k; ++l) {
+            A[j][l] = (S_dd[j][l] - S_d[j] * S_d[l] / N) / (N - 1.0);
+            A[l][j] = A[j][l];
+        }
+    }
+
+    // 5) β = Σ_dd⁻¹ Σ_df
+    solve_least_squares(A, b, k, beta.data());
+
+    // 6) Second pass: h_i = f_i − Σ_j β_j d_ij, recomputing d_ij from the stored (x_i, y_i)
+    for (int i = 0; i < M; ++i) {
+        centered_controls(outputs[i].x, outputs[i].y, antithetic, controls, means, d);
+        double adjust = 0.0;
+        for (int j = 0; j < k; ++j) {
+            adjust += beta[j] * d[j];
+        }
+        outputs[i].value -= adjust;
+    }
+}
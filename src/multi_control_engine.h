@@ -0,0 +1,56 @@
+#ifndef MULTI_CONTROL_ENGINE_H
+#define MULTI_CONTROL_ENGINE_H
+
+#include "engine.h"     // defines struct Sample { double x, y, value; };
+#include "controls.h"   // control catalog, kNumControls
+#include "rng_streams.h"  // RngStream (counter-based, seekable PRNG)
+#include <vector>       // for std::vector
+
+// MultiControlEngine: several control variates at once, β by least squares.
+//
+//   Draws (x_i, y_i) ∼ Uniform([0,1]^2), f_i = 4·I{x_i^2 + y_i^2 ≤ 1}, and for each selected
+//   control j (see controls.h) the centered value d_ij = g_j(x_i, y_i) − E[g_j].
+//   The adjusted value
+//       h_i = f_i − Σ_j β_j d_ij,       E[h] = π,
+//   has minimal variance for the least-squares coefficients
+//       β = Σ_dd⁻¹ Σ_df,
+//   where Σ_dd is the k×k sample covariance of the controls and Σ_df their covariance
+//   with f.  This generalizes the scalar β = Cov(f,g)/Var(g) of ControlVariateEngine.
+//
+//   Memory: the first pass writes Sample{x_i, y_i, f_i} straight into `outputs` while
+//   accumulating the (k+1)×(k+1) moment sums in fixed-size arrays; β is then solved once
+//   and a second pass recomputes g_j from the stored (x_i, y_i) to adjust the values in
+//   place.  No per-sample f/g vectors are kept.
+//
+//   Controls that are (numerically) constant or linearly dependent on earlier ones get
+//   β_j = 0 — e.g. x and y with antithetic pairs, whose pair-average is always 1/2.
+//
+//   antithetic: pair (x,y) with (1−x,1−y) as in ControlAntitheticEngine; f and every
+//   g_j are pair-averaged and ⌊n/2⌋ Samples are returned.
+class MultiControlEngine : public Engine {
+public:
+    // Constructor: seed the RNG; `controls_` are catalog indices (see find_controls)
+    MultiControlEngine(const std::vector<int>& controls_, bool antithetic_ = false);
+
+    // Destructor: nothing special
+    ~MultiControlEngine();
+
+    // sample(n, outputs):
+    //   – plain:       outputs.size() == n
+    //   – antithetic:  outputs.size() == ⌊n/2⌋
+    void sample(int n, std::vector<Sample>& outputs) override;
+
+    // β from the most recent sample() call, one entry per selected control
+    const std::vector<double>& coefficients() const { return beta; }
+
+    // Restart the PRNG at (seed, stream, offset) of the stream registry (see Engine::seed).
+    void seed(std::uint64_t seed_value, std::uint64_t stream, std::uint64_t offset) override;
+
+private:
+    RngStream rng;  // Philox stream, addressed by (seed, stream, offset)
+    std::vector<int> controls;   // selected catalog indices, k = controls.size() ≤ kNumControls
+    bool antithetic;             // pair (x,y) with (1−x,1−y)
+    std::vector<double> beta;    // least-squares coefficients of the last run
+};
+
+#endif // MULTI_CONTROL_ENGINE_H
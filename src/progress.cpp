@@ -0,0 +1,188 @@
+#include "progress.h"   // corresponding header
+#include <cerrno>       // for errno
+#include <cstring>      // for std::memcpy, std::memset, std::strerror, std::strncpy
+#include <iostream>     // for std::cerr
+#include <thread>       // for std::this_thread::yield
+
+#if defined(__unix__) || defined(__APPLE__)
+#define VR_PROGRESS_POSIX 1
+#include <fcntl.h>      // for O_CREAT, O_RDWR, O_RDONLY
+#include <sys/mman.h>   // for shm_open, mmap, munmap
+#include <unistd.h>     // for ftruncate, close, getpid
+#endif
+
+ProgressPublisher::ProgressPublisher()
+    : segment(nullptr), accumulating(false)
+{
+    std::memset(&current, 0, sizeof(current));
+}
+
+ProgressPublisher::~ProgressPublisher() {
+    // Keep the segment itself so readers can still see the final snapshot
+#ifdef VR_PROGRESS_POSIX
+    if (segment != nullptr) {
+        munmap(segment, sizeof(ProgressSegment));
+    }
+#endif
+}
+
+bool ProgressPublisher::open(const std::string& name, const std::string& engine,
+                             long long requested, double target_stderr) {
+#ifndef VR_PROGRESS_POSIX
+    (void)engine;
+    (void)requested;
+    (void)target_stderr;
+    std::cerr << "Warning: PROGRESS = " << name << " ignored (no POSIX shared memory).\n";
+    return false;
+#else
+    int fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0644);
+    if (fd < 0) {
+        std::cerr << "Warning: Could not open progress segment \"" << name << "\": "
+                  << std::strerror(errno) << "\n";
+        return false;
+    }
+    if (ftruncate(fd, sizeof(ProgressSegment)) < 0) {
+        std::cerr << "Warning: Could not size progress segment \"" << name << "\": "
+                  << std::strerror(errno) << "\n";
+        close(fd);
+        return false;
+    }
+    void* mapped = mmap(nullptr, sizeof(ProgressSegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        std::cerr << "Warning: Could not map progress segment \"" << name << "\": "
+                  << std::strerror(errno) << "\n";
+        return false;
+    }
+
+    segment = static_cast<ProgressSegment*>(mapped);
+    // A reused segment may hold an odd sequence left by a writer that died mid-update;
+    // restart at 0 so our writes are odd while in progress and even when complete
+    segment->sequence.store(0, std::memory_order_release);
+    segment->magic = kProgressMagic;
+    segment->version = kProgressVersion;
+
+    std::strncpy(current.engine, engine.c_str(), sizeof(current.engine) - 1);
+    current.pid = static_cast<std::int64_t>(getpid());
+    current.requested = requested;
+    current.target_stderr = target_stderr;
+    current.eta_seconds = -1.0;
+    current.eta_target_seconds = -1.0;
+    start = std::chrono::steady_clock::now();
+
+    publish(kPhaseStarting, 0, 0.0, 0.0, 0.0);
+    return true;
+#endif
+}
+
+void ProgressPublisher::set_engine(const std::string& engine) {
+    std::memset(current.engine, 0, sizeof(current.engine));
+    std::strncpy(current.engine, engine.c_str(), sizeof(current.engine) - 1);
+}
+
+void ProgressPublisher::set_total(long long total) {
+    // Sampling is done and accumulation starts now: the rate counts from here, with done = 0
+    current.total = total;
+    accumulating = true;
+    accumulate = std::chrono::steady_clock::now();
+}
+
+void ProgressPublisher::publish(ProgressPhase phase, long long done, double mean,
+                                double variance, double std_error) {
+    if (segment == nullptr) {
+        return;
+    }
+
+    // 1) Derived fields: rate over the accumulation phase, ETAs at that rate
+    auto now = std::chrono::steady_clock::now();
+    current.phase = phase;
+    current.done = done;
+    current.mean = mean;
+    current.variance = variance;
+    current.std_error = std_error;
+    current.elapsed_seconds = std::chrono::duration<double>(now - start).count();
+
+    double busy = accumulating ? std::chrono::duration<double>(now - accumulate).count() : 0.0;
+    current.samples_per_second = (busy > 0.0) ? static_cast<double>(done) / busy : 0.0;
+
+    current.eta_seconds = -1.0;
+    current.eta_target_seconds = -1.0;
+    current.target_unreachable = 0;
+    if (phase == kPhaseDone) {
+        current.eta_seconds = 0.0;
+    } else if (current.samples_per_second > 0.0) {
+        current.eta_seconds = static_cast<double>(current.total - done) / current.samples_per_second;
+    }
+    if (current.target_stderr > 0.0 && done > 1) {
+        if (std_error <= current.target_stderr) {
+            current.eta_target_seconds = 0.0;
+        } else if (current.samples_per_second > 0.0) {
+            // stderr² = σ²/n  ⇒  n_target = σ² / target²
+            double needed = variance / (current.target_stderr * current.target_stderr);
+            if (current.total > 0 && needed > static_cast<double>(current.total)) {
+                // The run stops at `total` values, short of the target: no ETA
+                current.target_unreachable = 1;
+            } else {
+                current.eta_target_seconds = (needed - static_cast<double>(done)) / current.samples_per_second;
+            }
+        }
+    }
+
+    // 2) Seqlock write: odd sequence, data, even sequence
+    std::uint64_t seq = segment->sequence.load(std::memory_order_relaxed);
+    segment->sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(&segment->snapshot, &current, sizeof(current));
+    segment->sequence.store(seq + 2, std::memory_order_release);
+}
+
+const ProgressSegment* open_progress(const std::string& name) {
+#ifndef VR_PROGRESS_POSIX
+    (void)name;
+    return nullptr;
+#else
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        return nullptr;
+    }
+    void* mapped = mmap(nullptr, sizeof(ProgressSegment), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        return nullptr;
+    }
+    return static_cast<const ProgressSegment*>(mapped);
+#endif
+}
+
+void close_progress(const ProgressSegment* segment) {
+#ifdef VR_PROGRESS_POSIX
+    if (segment != nullptr) {
+        munmap(const_cast<ProgressSegment*>(segment), sizeof(ProgressSegment));
+    }
+#else
+    (void)segment;
+#endif
+}
+
+bool read_progress(const ProgressSegment* segment, ProgressSnapshot& out) {
+    if (segment->magic != kProgressMagic || segment->version != kProgressVersion) {
+        return false;
+    }
+    // Seqlock read: retry while a write is in progress or happened during the copy.
+    // Bounded, so a writer that died mid-update cannot hang the reader.
+    constexpr int kMaxAttempts = 100000;
+    for (int attempt = 0; attempt < kMaxAttempts; ++attempt) {
+        std::uint64_t before = segment->sequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            std::this_thread::yield();
+            continue;
+        }
+        std::memcpy(&out, &segment->snapshot, sizeof(out));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        std::uint64_t after = segment->sequence.load(std::memory_order_relaxed);
+        if (before == after) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,107 @@
+#ifndef PROGRESS_H
+#define PROGRESS_H
+
+#include <atomic>    // for std::atomic
+#include <chrono>    // for std::chrono::steady_clock
+#include <cstdint>   // for fixed-width integer types
+#include <string>    // for std::string
+
+// Live progress of a monte_carlo_pi run, published to a POSIX shared-memory segment.
+//
+//   With PROGRESS = /name in input.in, main() maps /dev/shm/name and overwrites a
+//   ProgressSnapshot every kPublishInterval samples (and at each phase change).  Readers
+//   such as monte_carlo_top map the same segment read-only and poll it; they never block or
+//   slow the writer.
+//
+//   Consistency uses a seqlock: the writer bumps `sequence` to an odd value, writes the
+//   snapshot, then bumps it to the next even value.  A reader copies the snapshot and
+//   retries if the sequence was odd or changed during the copy.  The segment is left in
+//   place when the run ends (phase = Done) so the final numbers stay visible; the next run
+//   with the same name overwrites it.
+
+constexpr std::uint32_t kProgressMagic   = 0x4D435047;   // "GPCM"
+constexpr std::uint32_t kProgressVersion = 2;   // v2: target_unreachable
+
+// Publish every this many samples in the hot loop (a power of two, so the check is a mask)
+constexpr long long kPublishInterval = 1 << 16;
+
+enum ProgressPhase : std::uint32_t {
+    kPhaseStarting     = 0,   // config read, engine being set up (Auto pilots run here)
+    kPhaseSampling     = 1,   // Engine::sample() / sample_hits() running; nothing is published
+                              // until it returns, so `done` stays 0 through this phase
+    kPhaseAccumulating = 2,   // statistics + results.log over the returned values
+    kPhaseDone         = 3,   // final numbers
+};
+
+// Plain data copied in and out under the seqlock.
+struct ProgressSnapshot {
+    char engine[64];             // engine name (NUL-terminated)
+    std::int64_t pid;            // writer process id
+    std::uint32_t phase;         // ProgressPhase
+    std::uint32_t target_unreachable;  // 1: this run's SAMPLES are too few for target_stderr
+    std::int64_t requested;      // SAMPLES
+    std::int64_t total;          // values the engine returned (0 until sampling ends)
+    std::int64_t done;           // values accumulated so far
+    double mean;                 // running estimate of π
+    double variance;             // running unbiased variance
+    double std_error;            // running standard error
+    double elapsed_seconds;      // since the run started
+    double samples_per_second;   // done / time spent accumulating (the statistics and
+                                 // results.log pass after sampling, not the draws)
+    double target_stderr;        // TARGET_STDERR (0 = none)
+    double eta_seconds;          // time to finish this run (−1 if unknown)
+    double eta_target_seconds;   // time until std_error ≤ target_stderr at the current rate
+                                 // (−1 if no target, unknown, or unreachable within `total`
+                                 // values; 0 if already met)
+};
+
+// Layout of the shared-memory segment.  std::atomic<std::uint64_t> is lock-free on all
+// supported platforms, so it works across processes.
+struct ProgressSegment {
+    std::uint32_t magic;                  // kProgressMagic
+    std::uint32_t version;                // kProgressVersion
+    std::atomic<std::uint64_t> sequence;  // seqlock counter, odd while a write is in progress
+    ProgressSnapshot snapshot;
+};
+
+// Writer side, used by main().  Inactive (all calls are no-ops) unless open() succeeded.
+class ProgressPublisher {
+public:
+    ProgressPublisher();
+    ~ProgressPublisher();
+
+    // Create or overwrite the segment `name` (e.g. "/monte_carlo_pi").  Prints a warning and
+    // stays inactive on failure.
+    bool open(const std::string& name, const std::string& engine, long long requested,
+              double target_stderr);
+
+    bool active() const { return segment != nullptr; }
+
+    // Engine name shown to readers (e.g. the winner of ENGINE = Auto)
+    void set_engine(const std::string& engine);
+
+    // Number of values the engine returned, once known; also starts the accumulation clock
+    // that samples_per_second and the ETAs are measured against
+    void set_total(long long total);
+
+    // Publish a new snapshot; rate and ETAs are derived from the clock and `done`.
+    void publish(ProgressPhase phase, long long done, double mean, double variance,
+                 double std_error);
+
+private:
+    ProgressSegment* segment;     // mapped segment, nullptr when inactive
+    ProgressSnapshot current;     // local copy; written out under the seqlock
+    std::chrono::steady_clock::time_point start;        // run start
+    std::chrono::steady_clock::time_point accumulate;   // set_total(): accumulation start
+    bool accumulating;
+};
+
+// Reader side, used by monte_carlo_top.  Maps `name` read-only; nullptr on failure.
+const ProgressSegment* open_progress(const std::string& name);
+void close_progress(const ProgressSegment* segment);
+
+// Copy a consistent snapshot (retrying while the writer is mid-update).  false if the
+// segment's magic or version does not match, or no consistent copy could be taken.
+bool read_progress(const ProgressSegment* segment, ProgressSnapshot& out);
+
+#endif // PROGRESS_H
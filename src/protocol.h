@@ -0,0 +1,64 @@
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+#include <cstdint>   // for fixed-width integer types
+
+// Binary protocol of `monte_carlo_pi --serve` (see service.h).
+//
+//   The client writes JobRequest records to a Unix domain stream socket and reads back one
+//   JobResponse per request.  Records are fixed-size, unframed and in host byte order (the
+//   socket is local).  Requests on one connection may be pipelined; responses are streamed
+//   back as jobs finish, so they can arrive out of order — match them by `id`.
+//
+//   Modes:
+//     target_stderr ≤ 0:  run exactly `samples` f-calls, like SAMPLES in input.in.
+//     target_stderr > 0:  run batches until the standard error is ≤ target_stderr, using at
+//                         most `samples` f-calls (0 = kDefaultSampleCap).
+
+constexpr std::uint32_t kRequestMagic  = 0x32435251;   // "QRC2" (56-byte layout)
+constexpr std::uint32_t kResponseMagic = 0x4D435253;   // "SRCM"
+
+// Largest f-call budget a single request may use (Engine::sample takes an int).
+constexpr std::uint64_t kDefaultSampleCap = 2000000000ULL;
+
+struct JobRequest {
+    std::uint32_t magic;          // kRequestMagic
+    std::uint16_t engine;         // index into engine_registry()
+    std::uint8_t  compact;        // nonzero: bit-packed results where supported
+    std::uint8_t  reserved;       // must be 0
+    std::uint64_t id;             // echoed in the response
+    std::uint64_t samples;        // f-calls (fixed mode) or f-call cap (target mode)
+    double        target_stderr;  // > 0 selects target mode
+    std::uint64_t seed;           // 0 = worker's warm random stream (independent of all other
+                                  // requests), else reproducible
+    std::uint64_t shard;          // with seed ≠ 0: stream shard (rng_streams.h), 0 = main
+    std::uint64_t offset;         // with seed ≠ 0: start position in 32-bit draws
+};
+
+// Response status codes
+enum JobStatus : std::uint32_t {
+    kJobOk             = 0,   // statistics are valid
+    kJobUnknownEngine  = 1,   // engine index out of range
+    kJobBadRequest     = 2,   // bad magic or reserved field, samples too large,
+                              // shard/offset given with seed 0, or a target_stderr that is
+                              // NaN/inf or whose square underflows or overflows
+    kJobTargetNotMet   = 3,   // sample cap reached before target_stderr (statistics valid)
+    kJobInternalError  = 4,   // the engine threw
+};
+
+struct JobResponse {
+    std::uint32_t magic;          // kResponseMagic
+    std::uint32_t status;         // JobStatus
+    std::uint64_t id;             // JobRequest::id
+    std::uint64_t samples_used;   // f-calls requested from the engine
+    std::uint64_t actual_samples; // values averaged
+    double        mean;           // estimate of π
+    double        variance;       // unbiased sample variance of the values
+    double        std_error;      // standard error of the mean
+    std::uint64_t elapsed_ns;     // time spent running the job in the worker
+};
+
+static_assert(sizeof(JobRequest) == 56, "JobRequest layout changed");
+static_assert(sizeof(JobResponse) == 64, "JobResponse layout changed");
+
+#endif // PROTOCOL_H
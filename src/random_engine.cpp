@@ -1,30 +1,31 @@
 #include "random_engine.h"   // header for this class
-#include <random>            // for std::random_device, std::uniform_real_distribution
 #include <cmath>             // for std::sqrt (not strictly needed here)
 #include <vector>            // for std::vector
 
-// Constructor: seed the Mersenne Twister with a non‐deterministic seed
+// Constructor: start a nondeterministically seeded stream
 RandomEngine::RandomEngine() {
-    std::random_device rd;        // obtain a random seed from the OS
-    rng = std::mt19937(rd());     // seed the PRNG
+    // Nondeterministic seed until seed() is called
+    rng = random_stream();
 }
 
 // Destructor: nothing to clean up
 RandomEngine::~RandomEngine() {}
 
+// seed(): restart at (seed, stream, offset); see rng_streams.h
+void RandomEngine::seed(std::uint64_t seed_value, std::uint64_t stream, std::uint64_t offset) {
+    rng = RngStream(seed_value, stream, offset);
+}
+
 // sample(): draw `samples` uniform points in [0,1]^2; fill outputs with Sample{x,y,value}
 void RandomEngine::sample(int samples, std::vector<Sample>& outputs) {
     // Clear any existing contents and reserve space for exactly `samples`
     outputs.clear();
     outputs.reserve(static_cast<size_t>(samples));
 
-    // Uniform distribution on [0,1)
-    std::uniform_real_distribution<double> dist(0.0, 1.0);
-
     for (int i = 0; i < samples; ++i) {
         // Draw a uniform x and y in [0,1)
-        double x = dist(rng);
-        double y = dist(rng);
+        double x = uniform01(rng);
+        double y = uniform01(rng);
 
         // Determine if (x,y) lies inside the unit quarter‐circle
         bool inside = (x * x + y * y) <= 1.0;
@@ -36,3 +37,19 @@ void RandomEngine::sample(int samples, std::vector<Sample>& outputs) {
         outputs.push_back(Sample{ x, y, val });
     }
 }
+
+// sample_hits(): identical draws to sample(), but pack the in‐circle indicator into 64‐bit words
+int RandomEngine::sample_hits(int samples, std::vector<std::uint64_t>& words) {
+    // One word per 64 draws; the last word may be partially filled (high bits stay zero)
+    words.assign((static_cast<size_t>(samples) + 63) / 64, 0);
+
+    for (int i = 0; i < samples; ++i) {
+        double x = uniform01(rng);
+        double y = uniform01(rng);
+
+        // Set bit (i % 64) of word (i / 64) if (x,y) lies inside the quarter‐circle
+        std::uint64_t inside = (x * x + y * y) <= 1.0 ? 1u : 0u;
+        words[static_cast<size_t>(i) >> 6] |= inside << (i & 63);
+    }
+    return samples;
+}
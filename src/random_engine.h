@@ -2,7 +2,7 @@
 #define RANDOM_ENGINE_H
 
 #include "engine.h"     // base Engine + Sample struct
-#include <random>       // for std::mt19937 and std::uniform_real_distribution
+#include "rng_streams.h"  // RngStream (counter-based, seekable PRNG)
 
 // RandomEngine: plain Monte Carlo in [0,1]^2 to estimate π via 4·I[(x,y) inside quarter‐circle]
 class RandomEngine : public Engine {
@@ -16,8 +16,15 @@ public:
     // Override: generate up to `samples` uniform points in [0,1]^2 and compute value=4·I[in‐circle].
     void sample(int samples, std::vector<Sample>& outputs) override;
 
+    // Compact mode: same draws as sample(), but only the in-circle bit is kept (64 per word).
+    bool supports_hits() const override { return true; }
+    int sample_hits(int samples, std::vector<std::uint64_t>& words) override;
+
+    // Restart the PRNG at (seed, stream, offset) of the stream registry (see Engine::seed).
+    void seed(std::uint64_t seed_value, std::uint64_t stream, std::uint64_t offset) override;
+
 private:
-    std::mt19937 rng;  // Mersenne Twister PRNG
+    RngStream rng;  // Philox stream, addressed by (seed, stream, offset)
 };
 
 #endif // RANDOM_ENGINE_H
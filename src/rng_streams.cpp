@@ -0,0 +1,59 @@
+#include "rng_streams.h"   // corresponding header
+#include <random>          // for std::random_device
+
+std::uint64_t engine_stream_id(const std::string& engine_name) {
+    // 64-bit FNV-1a
+    std::uint64_t hash = 0xCBF29CE484222325ULL;
+    for (unsigned char c : engine_name) {
+        hash ^= c;
+        hash *= 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+std::uint64_t random_seed() {
+    std::random_device rd;
+    return (static_cast<std::uint64_t>(rd()) << 32) | static_cast<std::uint64_t>(rd());
+}
+
+RngStream random_stream() {
+    return RngStream(random_seed(), 0, 0);
+}
+
+// refill(): ten Philox rounds on counter (block, stream_id) with key key_seed
+void RngStream::refill() {
+    constexpr std::uint32_t M0 = 0xD2511F53u;   // round multipliers
+    constexpr std::uint32_t M1 = 0xCD9E8D57u;
+    constexpr std::uint32_t W0 = 0x9E3779B9u;   // key schedule (Weyl) increments
+    constexpr std::uint32_t W1 = 0xBB67AE85u;
+
+    std::uint32_t c0 = static_cast<std::uint32_t>(block);
+    std::uint32_t c1 = static_cast<std::uint32_t>(block >> 32);
+    std::uint32_t c2 = static_cast<std::uint32_t>(stream_id);
+    std::uint32_t c3 = static_cast<std::uint32_t>(stream_id >> 32);
+    std::uint32_t k0 = static_cast<std::uint32_t>(key_seed);
+    std::uint32_t k1 = static_cast<std::uint32_t>(key_seed >> 32);
+
+    for (int round = 0; round < 10; ++round) {
+        std::uint64_t p0 = static_cast<std::uint64_t>(M0) * c0;
+        std::uint64_t p1 = static_cast<std::uint64_t>(M1) * c2;
+        std::uint32_t hi0 = static_cast<std::uint32_t>(p0 >> 32);
+        std::uint32_t lo0 = static_cast<std::uint32_t>(p0);
+        std::uint32_t hi1 = static_cast<std::uint32_t>(p1 >> 32);
+        std::uint32_t lo1 = static_cast<std::uint32_t>(p1);
+
+        c0 = hi1 ^ c1 ^ k0;
+        c1 = lo1;
+        c2 = hi0 ^ c3 ^ k1;
+        c3 = lo0;
+
+        k0 += W0;
+        k1 += W1;
+    }
+
+    buffer[0] = c0;
+    buffer[1] = c1;
+    buffer[2] = c2;
+    buffer[3] = c3;
+    index = 0;
+}
@@ -0,0 +1,125 @@
+#ifndef RNG_STREAMS_H
+#define RNG_STREAMS_H
+
+#include <cstdint>   // for std::uint32_t, std::uint64_t
+#include <string>    // for std::string
+
+// Versioned registry of reproducible random-number streams.
+//
+//   Every generator in the program is an RngStream addressed by (seed, stream-id, offset):
+//     seed    – the run's SEED (input.in), job seed (C API / service), or a random seed
+//     stream  – which consumer: engine_stream_id(name) for an engine's main stream,
+//               shard_stream_id(name, k) for shard k of a job split across machines or
+//               threads, sub_stream_id(parent, i) for the i-th block / pilot under it
+//     offset  – position inside the stream, counted in 32-bit draws
+//   RngStream is counter-based (Philox4x32-10), so any (seed, stream, offset) can be
+//   opened or jumped to in O(1), streams of one seed never overlap, and a sub-range of a
+//   huge run can be regenerated in isolation.
+//
+//   kStreamRegistryVersion identifies the derivation rules: the Philox variant, the
+//   stream-id hashing below, the mapping of draws to doubles (uniform01), and the order in
+//   which each engine consumes its draws.  Engines use uniform01 rather than the standard
+//   <random> distributions, whose output is implementation-defined and could differ
+//   between standard libraries.
+//   Any change to them must bump the version, since the same SEED would then replay a
+//   different workload.
+constexpr std::uint32_t kStreamRegistryVersion = 2;   // v2: uniform01 replaces <random>
+
+// SplitMix64 finalizer: a fast bijective 64-bit mixer.
+inline std::uint64_t mix64(std::uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Main stream of the engine registered as `engine_name` (64-bit FNV-1a of the name).
+std::uint64_t engine_stream_id(const std::string& engine_name);
+
+// The `index`-th sub-stream of `parent` (blocks, pilots, workers, ...).
+inline std::uint64_t sub_stream_id(std::uint64_t parent, std::uint64_t index) {
+    return mix64(parent ^ mix64(index + 0x9E3779B97F4A7C15ULL));
+}
+
+// Stream of shard `shard` of engine `engine_name`: shard 0 is the engine's main stream
+// (what SEED alone replays), shard k ≥ 1 is sub_stream_id(engine_stream_id(name), k).
+// Sub-stream 0 is reserved for ENGINE = Auto's pilots.
+inline std::uint64_t shard_stream_id(const std::string& engine_name, std::uint64_t shard) {
+    std::uint64_t main_stream = engine_stream_id(engine_name);
+    return shard == 0 ? main_stream : sub_stream_id(main_stream, shard);
+}
+
+// A fresh nondeterministic seed from std::random_device (64 bits).
+std::uint64_t random_seed();
+
+// RngStream: Philox4x32-10 counter-based generator (Salmon et al., SC'11).
+//
+//   key     = seed                       (2 × 32 bits)
+//   counter = (offset / 4, stream)       (block number: 2 × 32 bits, stream: 2 × 32 bits)
+//   Each counter value is encrypted into 4 outputs; output offset % 4 of block offset / 4
+//   is the draw at `offset`.
+//
+// Satisfies UniformRandomBitGenerator; engines draw doubles through uniform01() below.
+class RngStream {
+public:
+    using result_type = std::uint32_t;
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return 0xFFFFFFFFu; }
+
+    // Stream (seed = 0, stream = 0) at offset 0
+    RngStream() : RngStream(0, 0, 0) {}
+
+    RngStream(std::uint64_t seed, std::uint64_t stream, std::uint64_t offset = 0)
+        : key_seed(seed), stream_id(stream)
+    {
+        seek(offset);
+    }
+
+    // Next 32-bit draw
+    result_type operator()() {
+        if (index == 4) {
+            ++block;
+            refill();
+        }
+        return buffer[index++];
+    }
+
+    // Jump to an absolute offset (in 32-bit draws) in O(1)
+    void seek(std::uint64_t offset) {
+        block = offset >> 2;
+        refill();
+        index = static_cast<unsigned>(offset & 3);
+    }
+
+    // Skip `n` draws in O(1)
+    void discard(std::uint64_t n) { seek(position() + n); }
+
+    // Current offset, seed and stream id: together they reproduce the next draw
+    std::uint64_t position() const { return (block << 2) + index; }
+    std::uint64_t seed() const { return key_seed; }
+    std::uint64_t stream() const { return stream_id; }
+
+private:
+    void refill();   // buffer = Philox4x32-10(counter = (block, stream_id), key = key_seed)
+
+    std::uint64_t key_seed;    // Philox key
+    std::uint64_t stream_id;   // high half of the counter
+    std::uint64_t block;       // low half of the counter
+    std::uint32_t buffer[4];   // outputs of the current block
+    unsigned index;            // next output in `buffer` (4 = exhausted)
+};
+
+// Uniform double in [0,1) from the next two draws: the top 27 bits of the first and the
+// top 26 bits of the second form a 53-bit integer k, returned as k · 2^-53.  Fixed here, so
+// the stream layout does not depend on the standard library.
+inline double uniform01(RngStream& rng) {
+    std::uint64_t high = rng() >> 5;
+    std::uint64_t low  = rng() >> 6;
+    return static_cast<double>((high << 26) | low) * (1.0 / 9007199254740992.0);
+}
+
+// An RngStream seeded from std::random_device (stream 0), for engines that have not been
+// given a (seed, stream) explicitly.
+RngStream random_stream();
+
+#endif // RNG_STREAMS_H
@@ -0,0 +1,37 @@
+#include "running_stats.h"  // corresponding header
+#include <cmath>            // for std::sqrt
+
+// merge(): combine (n_a, mean_a, M2_a) and (n_b, mean_b, M2_b)
+//   delta = mean_b − mean_a
+//   mean  = mean_a + delta · n_b / n
+//   M2    = M2_a + M2_b + delta² · n_a n_b / n
+void RunningStats::merge(const RunningStats& other) {
+    if (other.n == 0) {
+        return;
+    }
+    if (n == 0) {
+        *this = other;
+        return;
+    }
+    double na = static_cast<double>(n);
+    double nb = static_cast<double>(other.n);
+    double total = na + nb;
+    double delta = other.mu - mu;
+    mu += delta * nb / total;
+    M2 += other.M2 + delta * delta * na * nb / total;
+    n += other.n;
+}
+
+double RunningStats::variance() const {
+    if (n > 1) {
+        return M2 / static_cast<double>(n - 1);
+    }
+    return 0.0;
+}
+
+double RunningStats::std_error() const {
+    if (n > 1) {
+        return std::sqrt(variance() / static_cast<double>(n));
+    }
+    return 0.0;
+}
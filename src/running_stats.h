@@ -0,0 +1,44 @@
+#ifndef RUNNING_STATS_H
+#define RUNNING_STATS_H
+
+// RunningStats: Welford's one-pass running mean and variance.
+//
+//   push(v):   mean += (v − mean)/n;   M2 += (v − mean_old)(v − mean_new)
+//   variance = M2/(n−1) for n > 1, else 0;   std_error = sqrt(variance/n)
+//
+// This gives a similar numerical accuracy to the usual two-pass version
+//   i) mean = sum(x_i) / N,   ii) var = sum(x - mean)^2 / (N-1)
+// without storing the values.  Two accumulators over disjoint data can be combined with
+// merge() (Chan et al.'s pairwise update), e.g. when samples are produced in batches.
+class RunningStats {
+public:
+    RunningStats() : n(0), mu(0.0), M2(0.0) {}
+
+    // Accumulator equivalent to `count` values with the given mean and unbiased variance
+    RunningStats(long long count, double mean, double variance)
+        : n(count), mu(mean), M2(count > 1 ? variance * static_cast<double>(count - 1) : 0.0) {}
+
+    // Add one value
+    void push(double value) {
+        ++n;
+        double delta = value - mu;
+        mu += delta / static_cast<double>(n);
+        double delta2 = value - mu;
+        M2 += delta * delta2;
+    }
+
+    // Fold in another accumulator's values
+    void merge(const RunningStats& other);
+
+    long long count() const { return n; }
+    double mean() const { return mu; }
+    double variance() const;    // unbiased sample variance, 0 for n ≤ 1
+    double std_error() const;   // sqrt(variance / n), 0 for n ≤ 1
+
+private:
+    long long n;   // number of values
+    double mu;     // running mean
+    double M2;     // running sum of squared deviations
+};
+
+#endif // RUNNING_STATS_H
@@ -0,0 +1,304 @@
+#include "service.h"          // corresponding header
+#include "engine_registry.h"  // engine_registry
+#include "estimate.h"         // run_estimate, run_to_target
+#include "protocol.h"         // JobRequest, JobResponse
+#include "rng_streams.h"      // shard_stream_id
+#include <atomic>             // for std::atomic
+#include <cerrno>             // for errno, EINTR
+#include <chrono>             // for std::chrono::steady_clock
+#include <climits>            // for INT_MAX
+#include <cmath>              // for std::isfinite, std::isnan
+#include <condition_variable> // for std::condition_variable
+#include <csignal>            // for sigaction, SIGINT, SIGTERM, SIGPIPE
+#include <cstring>            // for std::memset, std::strerror, std::strncpy
+#include <deque>              // for std::deque
+#include <iostream>           // for std::cout, std::cerr
+#include <memory>             // for std::shared_ptr, std::unique_ptr
+#include <mutex>              // for std::mutex
+#include <thread>             // for std::thread
+#include <vector>             // for std::vector
+
+#include <sys/socket.h>       // for socket, bind, listen, accept, send, recv
+#include <sys/un.h>           // for sockaddr_un
+#include <unistd.h>           // for close, unlink
+
+namespace {
+
+// Set by SIGINT/SIGTERM; interrupts accept() because the handler is installed without SA_RESTART
+std::atomic<bool> g_stop(false);
+
+extern "C" void handle_stop_signal(int) {
+    g_stop = true;
+}
+
+// Read exactly `size` bytes; false on EOF or error
+bool read_full(int fd, void* buffer, size_t size) {
+    char* p = static_cast<char*>(buffer);
+    while (size > 0) {
+        ssize_t got = recv(fd, p, size, 0);
+        if (got < 0 && errno == EINTR) {
+            continue;
+        }
+        if (got <= 0) {
+            return false;
+        }
+        p += got;
+        size -= static_cast<size_t>(got);
+    }
+    return true;
+}
+
+// Write exactly `size` bytes; false if the peer has gone away
+bool write_full(int fd, const void* buffer, size_t size) {
+    const char* p = static_cast<const char*>(buffer);
+    while (size > 0) {
+        ssize_t sent = send(fd, p, size, MSG_NOSIGNAL);
+        if (sent < 0 && errno == EINTR) {
+            continue;
+        }
+        if (sent <= 0) {
+            return false;
+        }
+        p += sent;
+        size -= static_cast<size_t>(sent);
+    }
+    return true;
+}
+
+// One client connection.  Shared by its reader thread and by every queued job, so the
+// socket stays open until the last response has been written.
+class Connection {
+public:
+    explicit Connection(int fd_) : fd(fd_) {}
+    ~Connection() { close(fd); }
+
+    int socket() const { return fd; }
+
+    // Responses from different workers are serialized on the socket
+    void send_response(const JobResponse& response) {
+        std::lock_guard<std::mutex> lock(write_mutex);
+        write_full(fd, &response, sizeof(response));
+    }
+
+private:
+    int fd;
+    std::mutex write_mutex;
+};
+
+struct Job {
+    JobRequest request;
+    std::shared_ptr<Connection> connection;
+};
+
+// FIFO of pending jobs shared by the readers (producers) and the workers (consumers)
+class JobQueue {
+public:
+    void push(Job job) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            jobs.push_back(std::move(job));
+        }
+        ready.notify_one();
+    }
+
+    // Blocks until a job is available; false once stop() was called and the queue is empty
+    bool pop(Job& job) {
+        std::unique_lock<std::mutex> lock(mutex);
+        ready.wait(lock, [this] { return stopped || !jobs.empty(); });
+        if (jobs.empty()) {
+            return false;
+        }
+        job = std::move(jobs.front());
+        jobs.pop_front();
+        return true;
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopped = true;
+        }
+        ready.notify_all();
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<Job> jobs;
+    bool stopped = false;
+};
+
+// A worker's engines: one warm, randomly seeded instance of every kind for seed = 0
+// requests, and a second set that seeded requests reseed for every job.  Keeping them
+// apart means a seeded request never changes the stream later seed = 0 requests draw from.
+struct WorkerEngines {
+    std::vector<std::unique_ptr<Engine>> warm;     // never reseeded after construction
+    std::vector<std::unique_ptr<Engine>> seeded;   // reseeded at (seed, shard, offset) per job
+};
+
+// Run one request on a worker's engines
+JobResponse run_job(const JobRequest& request, WorkerEngines& engines) {
+    JobResponse response;
+    std::memset(&response, 0, sizeof(response));
+    response.magic = kResponseMagic;
+    response.id = request.id;
+
+    if (request.magic != kRequestMagic || request.reserved != 0
+        || request.samples > kDefaultSampleCap
+        || (request.seed == 0 && (request.shard != 0 || request.offset != 0))) {
+        response.status = kJobBadRequest;
+        return response;
+    }
+    // Target mode needs a target whose square is a positive finite double (stderr² = σ²/n);
+    // NaN, ±inf, and targets that underflow or overflow when squared are rejected
+    const double target = request.target_stderr;
+    if (std::isnan(target)
+        || (target > 0.0 && (!std::isfinite(target * target) || target * target == 0.0))) {
+        response.status = kJobBadRequest;
+        return response;
+    }
+    if (request.engine >= engines.warm.size()) {
+        response.status = kJobUnknownEngine;
+        return response;
+    }
+    Engine& engine = request.seed != 0 ? *engines.seeded[request.engine]
+                                       : *engines.warm[request.engine];
+    bool compact = request.compact != 0;
+
+    auto start = std::chrono::steady_clock::now();
+    try {
+        // seed 0 continues the worker's warm random stream, independent of every other
+        // request; anything else restarts the seeded instance at (seed, shard, offset) of
+        // the engine's registry stream, so the same request reproduces the same estimate
+        if (request.seed != 0) {
+            engine.seed(request.seed, shard_stream_id(engine_registry()[request.engine].name,
+                                                      request.shard), request.offset);
+        }
+
+        Estimate estimate;
+        if (request.target_stderr > 0.0) {
+            long long cap = request.samples > 0
+                ? static_cast<long long>(request.samples) : static_cast<long long>(kDefaultSampleCap);
+            TargetEstimate target = run_to_target(engine, request.target_stderr, cap, compact);
+            estimate = target.estimate;
+            response.samples_used = static_cast<std::uint64_t>(target.samples_used);
+            response.status = target.target_met ? kJobOk : kJobTargetNotMet;
+        } else {
+            if (request.samples > static_cast<std::uint64_t>(INT_MAX)) {
+                response.status = kJobBadRequest;
+                return response;
+            }
+            estimate = run_estimate(engine, static_cast<int>(request.samples), compact);
+            response.samples_used = request.samples;
+            response.status = kJobOk;
+        }
+        response.actual_samples = static_cast<std::uint64_t>(estimate.actual_samples);
+        response.mean      = estimate.mean;
+        response.variance  = estimate.variance;
+        response.std_error = estimate.std_error;
+    } catch (...) {
+        response.status = kJobInternalError;
+    }
+    auto stop = std::chrono::steady_clock::now();
+    response.elapsed_ns = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+    return response;
+}
+
+// Worker: own instances of every registered engine, seeded once, then serve jobs forever
+void worker_loop(JobQueue& queue) {
+    WorkerEngines engines;
+    for (const EngineInfo& info : engine_registry()) {
+        // Workers are the parallelism: engines must not start threads of their own
+        EngineOptions options;
+        options.threads = 1;
+        engines.warm.push_back(info.create(options));
+        engines.seeded.push_back(info.create(options));
+    }
+
+    Job job;
+    while (queue.pop(job)) {
+        job.connection->send_response(run_job(job.request, engines));
+        job.connection.reset();
+    }
+}
+
+// Reader: turn the byte stream of one connection into queued jobs until the client hangs up
+// (the queue is shared so that a reader outliving run_service() never touches freed memory)
+void reader_loop(std::shared_ptr<Connection> connection, std::shared_ptr<JobQueue> queue) {
+    JobRequest request;
+    while (read_full(connection->socket(), &request, sizeof(request))) {
+        queue->push(Job{ request, connection });
+    }
+}
+
+} // namespace
+
+int run_service(const std::string& socket_path, int workers) {
+    // 1) Create, bind and listen on the Unix domain socket (replacing a stale socket file)
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(address.sun_path)) {
+        std::cerr << "Error: Socket path \"" << socket_path << "\" is too long.\n";
+        return 1;
+    }
+    std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+
+    int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0) {
+        std::cerr << "Error: socket(): " << std::strerror(errno) << "\n";
+        return 1;
+    }
+    unlink(socket_path.c_str());
+    if (bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0
+        || listen(listener, SOMAXCONN) < 0) {
+        std::cerr << "Error: Cannot listen on \"" << socket_path << "\": " << std::strerror(errno) << "\n";
+        close(listener);
+        return 1;
+    }
+
+    // 2) Stop on SIGINT/SIGTERM (no SA_RESTART, so accept() returns EINTR)
+    struct sigaction action;
+    std::memset(&action, 0, sizeof(action));
+    action.sa_handler = handle_stop_signal;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, nullptr);
+    sigaction(SIGTERM, &action, nullptr);
+
+    // 3) Start the warm worker pool
+    if (workers <= 0) {
+        unsigned hw = std::thread::hardware_concurrency();
+        workers = hw > 0 ? static_cast<int>(hw) : 1;
+    }
+    std::shared_ptr<JobQueue> queue = std::make_shared<JobQueue>();
+    std::vector<std::thread> pool;
+    for (int w = 0; w < workers; ++w) {
+        pool.emplace_back(worker_loop, std::ref(*queue));
+    }
+
+    std::cout << "Serving on " << socket_path << " with " << workers << " workers\n" << std::flush;
+
+    // 4) Accept connections; each gets a detached reader thread
+    while (!g_stop) {
+        int fd = accept(listener, nullptr, nullptr);
+        if (fd < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            std::cerr << "Warning: accept(): " << std::strerror(errno) << "\n";
+            continue;
+        }
+        std::thread(reader_loop, std::make_shared<Connection>(fd), queue).detach();
+    }
+
+    // 5) Shut down: no new connections, let the workers drain the queue
+    close(listener);
+    unlink(socket_path.c_str());
+    queue->stop();
+    for (std::thread& t : pool) {
+        t.join();
+    }
+    std::cout << "Service stopped\n";
+    return 0;
+}
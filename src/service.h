@@ -0,0 +1,27 @@
+#ifndef SERVICE_H
+#define SERVICE_H
+
+#include <string>   // for std::string
+
+// `monte_carlo_pi --serve`: a long-running estimation service on a Unix domain socket.
+//
+//   At start-up a pool of `workers` threads is created; each worker constructs one engine
+//   of every registered kind up front, so every engine's PRNG is already seeded (from
+//   std::random_device) and warm when the first request arrives.  Requests with seed 0 use
+//   these warm streams and are always independent of other requests; seeded requests run on
+//   a separate instance per kind, reseeded for each job, so they never disturb the warm ones.
+//   Clients connect to `socket_path` and exchange fixed-size binary records (protocol.h):
+//   requests are read by one reader thread per connection and queued; any idle worker runs
+//   the job on its own engine instance and writes the response back on the originating
+//   connection.
+//
+//   Nothing touches input.in or results.log.  SIGINT/SIGTERM stop the service and remove
+//   the socket file.
+//
+// Returns 0 on a clean shutdown, 1 if the socket could not be set up.
+int run_service(const std::string& socket_path, int workers);
+
+// Default socket path used by --serve and monte_carlo_client
+constexpr const char* kDefaultSocketPath = "/tmp/monte_carlo_pi.sock";
+
+#endif // SERVICE_H
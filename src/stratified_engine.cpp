@@ -1,21 +1,24 @@
 #include "stratified_engine.h"   // header for this class
 #include <cmath>                 // for std::sqrt, std::floor
-#include <random>                // for std::uniform_real_distribution
 #include <iostream>              // for std::cerr
 #include <vector>                // for std::vector
 
-// Constructor: seed RNG with std::random_device
+// Constructor: start a nondeterministically seeded stream
 StratifiedEngine::StratifiedEngine() {
-    std::random_device rd;      
-    rng = std::mt19937(rd());  
+    // Nondeterministic seed until seed() is called
+    rng = random_stream();
 }
 
 // Destructor: nothing special
 StratifiedEngine::~StratifiedEngine() {}
 
-// sample(): perform stratified sampling in [0,1]^2
-void StratifiedEngine::sample(int samples, std::vector<Sample>& outputs) {
-    // Compute m = floor(sqrt(samples)), so total actual draws = m*m
+// seed(): restart at (seed, stream, offset); see rng_streams.h
+void StratifiedEngine::seed(std::uint64_t seed_value, std::uint64_t stream, std::uint64_t offset) {
+    rng = RngStream(seed_value, stream, offset);
+}
+
+// grid_size(): m = floor(sqrt(samples)); warn if samples is not a perfect square
+int StratifiedEngine::grid_size(int samples) const {
     int m = static_cast<int>(std::floor(std::sqrt(static_cast<double>(samples))));
     int total = m * m;
 
@@ -24,20 +27,25 @@ void StratifiedEngine::sample(int samples, std::vector<Sample>& outputs) {
         std::cerr << "Warning: StratifiedEngine requires a perfect square. "
                   << "Using " << total << " samples instead of " << samples << ".\n";
     }
+    return m;
+}
+
+// sample(): perform stratified sampling in [0,1]^2
+void StratifiedEngine::sample(int samples, std::vector<Sample>& outputs) {
+    // m×m grid; total actual draws = m*m
+    int m = grid_size(samples);
+    int total = m * m;
 
     // Clear outputs and reserve exactly total
     outputs.clear();
     outputs.reserve(static_cast<size_t>(total));
 
-    // Uniform offset within [0,1)
-    std::uniform_real_distribution<double> dist(0.0, 1.0);
-
     // Loop over each stratum cell (i, j)
     for (int i = 0; i < m; ++i) {
         for (int j = 0; j < m; ++j) {
             // Draw a uniform sub‐point (u,v) ∈ [0,1)²
-            double u = dist(rng);
-            double v = dist(rng);
+            double u = uniform01(rng);
+            double v = uniform01(rng);
 
             // Map into the (i,j)-th stratum in [0,1]
             double x = (static_cast<double>(i) + u) / static_cast<double>(m);
@@ -54,3 +62,27 @@ void StratifiedEngine::sample(int samples, std::vector<Sample>& outputs) {
         }
     }
 }
+
+// sample_hits(): identical strata and draws to sample(), keeping only the in‐circle bit
+int StratifiedEngine::sample_hits(int samples, std::vector<std::uint64_t>& words) {
+    int m = grid_size(samples);
+    int total = m * m;
+
+    // One word per 64 draws; high bits of the last word stay zero
+    words.assign((static_cast<size_t>(total) + 63) / 64, 0);
+
+    size_t k = 0;  // running draw index, in the same (i, j) order as sample()
+    for (int i = 0; i < m; ++i) {
+        for (int j = 0; j < m; ++j, ++k) {
+            double u = uniform01(rng);
+            double v = uniform01(rng);
+
+            double x = (static_cast<double>(i) + u) / static_cast<double>(m);
+            double y = (static_cast<double>(j) + v) / static_cast<double>(m);
+
+            std::uint64_t inside = (x * x + y * y) <= 1.0 ? 1u : 0u;
+            words[k >> 6] |= inside << (k & 63);
+        }
+    }
+    return total;
+}
@@ -2,7 +2,7 @@
 #define STRATIFIED_ENGINE_H
 
 #include "engine.h"     // base Engine + Sample
-#include <random>       // for std::mt19937 and uniform_real_distribution
+#include "rng_streams.h"  // RngStream (counter-based, seekable PRNG)
 
 // StratifiedEngine: subdivide [0,1]^2 into m×m strata (m = floor(sqrt(samples))) and draw one point per cell
 class StratifiedEngine : public Engine {
@@ -17,8 +17,18 @@ public:
     // Fill outputs with exactly total Sample structs.
     void sample(int samples, std::vector<Sample>& outputs) override;
 
+    // Compact mode: same strata and draws as sample(), keeping only the in-circle bit (64 per word).
+    bool supports_hits() const override { return true; }
+    int sample_hits(int samples, std::vector<std::uint64_t>& words) override;
+
+    // Restart the PRNG at (seed, stream, offset) of the stream registry (see Engine::seed).
+    void seed(std::uint64_t seed_value, std::uint64_t stream, std::uint64_t offset) override;
+
 private:
-    std::mt19937 rng;  // Mersenne Twister PRNG
+    // Compute m = floor(sqrt(samples)) and warn if m*m != samples.
+    int grid_size(int samples) const;
+
+    RngStream rng;  // Philox stream, addressed by (seed, stream, offset)
 };
 
 #endif // STRATIFIED_ENGINE_H
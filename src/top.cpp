@@ -0,0 +1,102 @@
+// monte_carlo_top: live view of a monte_carlo_pi run's shared-memory progress snapshot.
+//
+//   monte_carlo_top [NAME] [--interval MS] [--once]
+//
+// NAME is the PROGRESS value from input.in (default "/monte_carlo_pi").  The segment is
+// mapped read-only and polled; reads use the seqlock in progress.h, so the writer is never
+// blocked.  Exits when the run reaches phase Done (or after one line with --once).
+
+#include "progress.h"   // open_progress, read_progress
+#include <chrono>       // for std::chrono::milliseconds
+#include <cstdlib>      // for std::atoi
+#include <iomanip>      // for std::fixed, std::setprecision, std::setw
+#include <iostream>     // for std::cout, std::cerr
+#include <sstream>      // for std::ostringstream
+#include <string>       // for std::string
+#include <thread>       // for std::this_thread::sleep_for
+
+namespace {
+
+const char* phase_name(std::uint32_t phase) {
+    switch (phase) {
+        case kPhaseStarting:     return "starting";
+        case kPhaseSampling:     return "sampling";
+        case kPhaseAccumulating: return "running";
+        case kPhaseDone:         return "done";
+        default:                 return "?";
+    }
+}
+
+// Seconds as a short string, "-" when unknown (negative)
+std::string format_eta(double seconds) {
+    if (seconds < 0.0) {
+        return "-";
+    }
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(1) << seconds << "s";
+    return out.str();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    // 1) Parse options
+    std::string name = "/monte_carlo_pi";
+    int interval_ms = 500;
+    bool once = false;
+    for (int a = 1; a < argc; ++a) {
+        std::string arg = argv[a];
+        if (arg == "--interval" && a + 1 < argc) {
+            interval_ms = std::atoi(argv[++a]);
+        } else if (arg == "--once") {
+            once = true;
+        } else if (!arg.empty() && arg[0] != '-') {
+            name = arg;
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [NAME] [--interval MS] [--once]\n";
+            return 1;
+        }
+    }
+
+    // 2) Map the segment read-only
+    const ProgressSegment* segment = open_progress(name);
+    if (segment == nullptr) {
+        std::cerr << "Error: No progress segment \"" << name << "\" (is PROGRESS set in input.in?)\n";
+        return 1;
+    }
+
+    // 3) Poll and print one line per interval
+    std::cout << std::left << std::setw(10) << "phase" << std::right
+              << std::setw(14) << "done" << std::setw(14) << "total"
+              << std::setw(13) << "mean" << std::setw(11) << "variance"
+              << std::setw(12) << "stderr" << std::setw(13) << "samples/s"
+              << std::setw(10) << "eta" << std::setw(12) << "eta target" << "\n";
+
+    ProgressSnapshot snap;
+    int status = 0;
+    for (;;) {
+        if (!read_progress(segment, snap)) {
+            std::cerr << "Error: \"" << name << "\" is not a readable monte_carlo_pi progress segment.\n";
+            status = 1;
+            break;
+        }
+        std::cout << std::left << std::setw(10) << phase_name(snap.phase) << std::right
+                  << std::setw(14) << snap.done << std::setw(14) << snap.total
+                  << std::fixed << std::setprecision(8) << std::setw(13) << snap.mean
+                  << std::setprecision(5) << std::setw(11) << snap.variance
+                  << std::scientific << std::setprecision(3) << std::setw(12) << snap.std_error
+                  << std::fixed << std::setprecision(0) << std::setw(13) << snap.samples_per_second
+                  << std::setw(10) << format_eta(snap.eta_seconds)
+                  << std::setw(12) << (snap.target_unreachable ? std::string("unreachable")
+                                                               : format_eta(snap.eta_target_seconds))
+                  << "   " << snap.engine << " (pid " << snap.pid << ")\n" << std::flush;
+
+        if (once || snap.phase == kPhaseDone) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(interval_ms));
+    }
+
+    close_progress(segment);
+    return status;
+}
@@ -26,10 +26,22 @@ std::string trim(const std::string& str) {
     return str.substr(start, end - start + 1);
 }
 
+// split_list(): comma-separated items, each trimmed; empty items are dropped
+std::vector<std::string> split_list(const std::string& value) {
+    std::vector<std::string> items;
+    std::istringstream list(value);
+    std::string item;
+    while (std::getline(list, item, ',')) {
+        item = trim(item);
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
 // read_config(): parse key=value pairs from filename.
-bool read_config(const std::string& filename,
-                 std::string& engine_out,
-                 int& samples_out){
+bool read_config(const std::string& filename, Config& config_out) {
     // Open the file for reading
     std::ifstream infile(filename);
     if (!infile.is_open()) {
@@ -38,8 +50,7 @@ bool read_config(const std::string& filename,
     }
 
     // Temporary storage for parsed values
-    std::string engine_temp;
-    int samples_temp = -1;
+    Config config_temp;
 
     std::string line;
     while (std::getline(infile, line)) {
@@ -64,30 +75,84 @@ bool read_config(const std::string& filename,
 
         // Check which key we have
         if (key == "ENGINE") {
-            engine_temp = value;
+            config_temp.engine = value;
         }
         else if (key == "SAMPLES") {
             try {
-                samples_temp = std::stoi(value);
+                config_temp.samples = std::stoi(value);
             } catch (const std::exception&) {
                 std::cerr << "Error: Unable to parse SAMPLES value: \"" << value << "\"\n";
                 infile.close();
                 return false;
             }
         }
+        else if (key == "RESULTS") {
+            if (value == "Compact") {
+                config_temp.compact = true;
+            } else if (value == "Full") {
+                config_temp.compact = false;
+            } else {
+                std::cerr << "Error: RESULTS must be Compact or Full, got \"" << value << "\"\n";
+                infile.close();
+                return false;
+            }
+        }
+        else if (key == "CONTROLS") {
+            // Comma-separated list of control names
+            config_temp.controls = split_list(value);
+        }
+        else if (key == "PROGRESS") {
+            config_temp.progress = value;
+        }
+        else if (key == "TARGET_STDERR") {
+            try {
+                config_temp.target_stderr = std::stod(value);
+            } catch (const std::exception&) {
+                std::cerr << "Error: Unable to parse TARGET_STDERR value: \"" << value << "\"\n";
+                infile.close();
+                return false;
+            }
+        }
+        else if (key == "SEED") {
+            try {
+                config_temp.seed = std::stoull(value);
+                config_temp.has_seed = true;
+            } catch (const std::exception&) {
+                std::cerr << "Error: Unable to parse SEED value: \"" << value << "\"\n";
+                infile.close();
+                return false;
+            }
+        }
+        else if (key == "STREAM_SHARD") {
+            try {
+                config_temp.stream_shard = std::stoull(value);
+            } catch (const std::exception&) {
+                std::cerr << "Error: Unable to parse STREAM_SHARD value: \"" << value << "\"\n";
+                infile.close();
+                return false;
+            }
+        }
+        else if (key == "STREAM_OFFSET") {
+            try {
+                config_temp.stream_offset = std::stoull(value);
+            } catch (const std::exception&) {
+                std::cerr << "Error: Unable to parse STREAM_OFFSET value: \"" << value << "\"\n";
+                infile.close();
+                return false;
+            }
+        }
         // Other keys are ignored
     }
 
     infile.close();  // close the file
 
     // Verify that ENGINE and SAMPLES were provided
-    if (engine_temp.empty() || samples_temp < 0) {
+    if (config_temp.engine.empty() || config_temp.samples < 0) {
         std::cerr << "Error: Config file must contain ENGINE and SAMPLES entries.\n";
         return false;
     }
 
     // Assign output parameters
-    engine_out = engine_temp;
-    samples_out = samples_temp;
+    config_out = config_temp;
     return true;
 }
@@ -1,23 +1,45 @@
 #ifndef UTILS_H
 #define UTILS_H
 
+#include <cstdint>  // for std::uint64_t
 #include <string>   // for std::string
+#include <vector>   // for std::vector
 
 // Trim whitespace from both ends of `str`
 std::string trim(const std::string& str);
 
+// Split a comma-separated list ("x, y, r") into trimmed, non-empty items.
+std::vector<std::string> split_list(const std::string& value);
+
+// Settings read from the config file.
+struct Config {
+    std::string engine;    // ENGINE  (required), e.g. "Random"
+    int samples = -1;      // SAMPLES (required), number of draws requested
+    bool compact = false;  // RESULTS = Compact | Full (optional, default Full)
+    std::vector<std::string> controls;  // CONTROLS = x, y, ... (optional, MultiControl engines)
+    std::string progress;        // PROGRESS = /name (optional): shared-memory progress segment
+    double target_stderr = 0.0;  // TARGET_STDERR (optional): ETA target for the progress segment
+    bool has_seed = false;       // SEED given?  Otherwise a random seed is drawn and reported
+    std::uint64_t seed = 0;      // SEED (optional): run seed of the stream registry
+    std::uint64_t stream_shard = 0;   // STREAM_SHARD (optional): stream shard, 0 = main stream
+    std::uint64_t stream_offset = 0;  // STREAM_OFFSET (optional): start position, in 32-bit draws
+};
+
 // Read a simple key=value config file named `filename`.
 // It expects lines like:
 //   SAMPLES =  1000
 //   ENGINE  = Random
+//   RESULTS = Compact      (optional)
+//   CONTROLS = x, x2+y2, r (optional, comma-separated)
+//   PROGRESS = /monte_carlo_pi  (optional)
+//   TARGET_STDERR = 0.0001 (optional)
+//   SEED = 12345           (optional)
+//   STREAM_SHARD = 0       (optional)
+//   STREAM_OFFSET = 0      (optional)
 //
-// Returns true if the file was read successfully. On success:
-//   - engine_out  is set to the ENGINE string
-//   - samples_out is set to the parsed integer
+// Returns true if the file was read successfully and fills `config_out`.
 //
 // If ENGINE or SAMPLES is missing, or if a parse error occurs, returns false.
-bool read_config(const std::string& filename,
-                 std::string& engine_out,
-                 int& samples_out);
+bool read_config(const std::string& filename, Config& config_out);
 
 #endif // UTILS_H
@@ -0,0 +1,142 @@
+#include "variance_reduction.h"  // C API declarations
+#include "controls.h"            // find_controls
+#include "engine_registry.h"     // engine_registry, make_engine
+#include "estimate.h"            // run_estimate
+#include "rng_streams.h"         // shard_stream_id
+#include "utils.h"               // split_list
+#include <algorithm>             // for std::min
+#include <atomic>                // for std::atomic
+#include <exception>             // for std::exception
+#include <memory>                // for std::unique_ptr
+#include <string>                // for std::string
+#include <thread>                // for std::thread
+#include <vector>                // for std::vector
+
+namespace {
+
+// Run one job; never throws.  `engine_threads` caps the threads an engine may start itself
+// (EngineOptions::threads).
+vr_result run_job(const vr_job& job, int engine_threads) {
+    vr_result result{ VR_OK, 0, 0.0, 0.0, 0.0 };
+
+    if (job.engine == nullptr || job.samples < 0
+        || (job.seed == 0 && (job.shard != 0 || job.offset != 0))) {
+        result.status = VR_INVALID_ARGUMENT;
+        return result;
+    }
+
+    try {
+        // Engine options: CONTROLS list (NULL = whole catalog)
+        EngineOptions options;
+        options.threads = engine_threads;
+        std::vector<std::string> names;
+        if (job.controls != nullptr) {
+            names = split_list(job.controls);
+        }
+        if (!find_controls(names, options.controls)) {
+            result.status = VR_INVALID_ARGUMENT;
+            return result;
+        }
+
+        std::unique_ptr<Engine> engine = make_engine(job.engine, options);
+        if (!engine) {
+            result.status = VR_UNKNOWN_ENGINE;
+            return result;
+        }
+
+        // seed 0 keeps the constructor's std::random_device seed; otherwise the job replays
+        // (seed, shard, offset) of the engine's registry stream, exactly as SEED,
+        // STREAM_SHARD and STREAM_OFFSET do in monte_carlo_pi
+        if (job.seed != 0) {
+            engine->seed(job.seed, shard_stream_id(job.engine, job.shard), job.offset);
+        }
+
+        Estimate estimate = run_estimate(*engine, job.samples, job.compact != 0);
+        result.actual_samples = estimate.actual_samples;
+        result.mean      = estimate.mean;
+        result.variance  = estimate.variance;
+        result.std_error = estimate.std_error;
+    } catch (const std::exception&) {
+        result.status = VR_INTERNAL_ERROR;
+    } catch (...) {
+        result.status = VR_INTERNAL_ERROR;
+    }
+    return result;
+}
+
+} // namespace
+
+extern "C" int vr_run_batch(const vr_job* jobs, vr_result* results, size_t count, int threads) {
+    if (count == 0) {
+        return 0;
+    }
+    if (jobs == nullptr || results == nullptr) {
+        return -1;
+    }
+
+    // Worker pool: each thread claims the next unclaimed job until none are left
+    std::atomic<size_t> next(0);
+    int engine_threads = 0;   // set below, once the pool size is known
+    auto worker = [&]() {
+        for (size_t i = next++; i < count; i = next++) {
+            results[i] = run_job(jobs[i], engine_threads);
+        }
+    };
+
+    if (threads <= 0) {
+        unsigned hw = std::thread::hardware_concurrency();
+        threads = hw > 0 ? static_cast<int>(hw) : 1;
+    }
+    threads = static_cast<int>(std::min<size_t>(static_cast<size_t>(threads), count));
+
+    // With a pool the jobs already use the cores: engines must not start threads of their own
+    engine_threads = threads > 1 ? 1 : 0;
+
+    if (threads == 1) {
+        worker();
+    } else {
+        std::vector<std::thread> pool;
+        try {
+            pool.reserve(static_cast<size_t>(threads));
+            for (int t = 0; t < threads; ++t) {
+                pool.emplace_back(worker);
+            }
+        } catch (...) {
+            // Could not start every thread: the calling thread helps with the remaining jobs
+            worker();
+        }
+        for (std::thread& t : pool) {
+            t.join();
+        }
+    }
+
+    int failed = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (results[i].status != VR_OK) {
+            ++failed;
+        }
+    }
+    return failed;
+}
+
+extern "C" int vr_engine_count(void) {
+    return static_cast<int>(engine_registry().size());
+}
+
+extern "C" const char* vr_engine_name(int index) {
+    const std::vector<EngineInfo>& registry = engine_registry();
+    if (index < 0 || index >= static_cast<int>(registry.size())) {
+        return nullptr;
+    }
+    return registry[static_cast<size_t>(index)].name.c_str();
+}
+
+extern "C" const char* vr_status_message(int status) {
+    switch (status) {
+        case VR_OK:               return "ok";
+        case VR_UNKNOWN_ENGINE:   return "unknown engine";
+        case VR_INVALID_ARGUMENT: return "invalid argument";
+        case VR_INTERNAL_ERROR:   return "internal error";
+        default:                  return "unknown status";
+    }
+}
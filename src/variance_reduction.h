@@ -0,0 +1,77 @@
+#ifndef VARIANCE_REDUCTION_H
+#define VARIANCE_REDUCTION_H
+
+/*
+ * C API of the variance_reduction library.
+ *
+ * Runs many independent Monte Carlo estimates of π in one call, without input.in,
+ * results.log or any text parsing.  Each job names a registered engine (the same names as
+ * ENGINE in input.in), a sample budget and a seed; results are written into a
+ * caller-provided array, one entry per job, in job order.
+ *
+ *     vr_job jobs[2] = {
+ *         { "ConditionalControlAntithetic", 1000000, 42, NULL, 0 },
+ *         { "Random",                       1000000, 43, NULL, 1 },
+ *     };
+ *     vr_result results[2];
+ *     int failed = vr_run_batch(jobs, results, 2, 0);
+ *
+ * Jobs are distributed over a pool of threads.  All functions are thread-safe.
+ */
+
+#include <stddef.h>   /* size_t */
+#include <stdint.h>   /* uint64_t */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Per-job status codes (vr_result.status). */
+enum {
+    VR_OK                = 0,   /* result is valid */
+    VR_UNKNOWN_ENGINE    = 1,   /* vr_job.engine is not a registered engine */
+    VR_INVALID_ARGUMENT  = 2,   /* negative samples, NULL engine, bad controls, or
+                                   shard/offset given with seed 0 */
+    VR_INTERNAL_ERROR    = 3    /* the engine threw (e.g. out of memory) */
+};
+
+/* One estimate to run. */
+typedef struct vr_job {
+    const char* engine;     /* registered engine name, e.g. "ConditionalControlAntithetic" */
+    int samples;            /* number of f-calls requested (SAMPLES), >= 0 */
+    uint64_t seed;          /* run seed (as SEED in input.in); 0 = nondeterministic */
+    const char* controls;   /* MultiControl engines: comma-separated CONTROLS, NULL = all */
+    int compact;            /* nonzero: bit-packed results where the engine supports them */
+    uint64_t shard;         /* stream shard (as STREAM_SHARD); 0 = the engine's main stream */
+    uint64_t offset;        /* start position in the stream, in 32-bit draws (STREAM_OFFSET) */
+} vr_job;
+
+/* Outcome of one job. */
+typedef struct vr_result {
+    int status;             /* VR_OK or one of the error codes above */
+    int actual_samples;     /* number of values averaged (may differ from samples) */
+    double mean;            /* estimate of π */
+    double variance;        /* unbiased sample variance of the values */
+    double std_error;       /* standard error of the mean */
+} vr_result;
+
+/*
+ * Run jobs[0..count-1] and write results[0..count-1].
+ * `threads` is the number of worker threads (0 = one per hardware thread).  With more
+ * than one worker, engines that could fill samples in parallel run single-threaded.
+ * Returns the number of jobs whose status is not VR_OK, or -1 if jobs/results is NULL.
+ */
+int vr_run_batch(const vr_job* jobs, vr_result* results, size_t count, int threads);
+
+/* Number of registered engines, and the name of engine `index` (NULL if out of range). */
+int vr_engine_count(void);
+const char* vr_engine_name(int index);
+
+/* Human-readable description of a status code. */
+const char* vr_status_message(int status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VARIANCE_REDUCTION_H */